@@ -19,6 +19,10 @@
 
 #include <avr/io.h>
 
+// --->User files
+
+#include "CICFilter.h"
+
 /* Macros, constants and definitions section ---------------------------------*/
 
 //--->Constants
@@ -143,6 +147,9 @@ typedef struct
 	volatile uint32_t *OVSbuffer;			/*!< Oversampling buffer */
 	/*! Measurement finished callback (of all channels) */
 	void (*OnCompleted)();
+	/*! CIC decimators of channels (optional, 10-bit resolution only),
+	    OnCompleted is then called only when they give new outputs */
+	CICFilter_t *Decimators;
 }ADC_t;
 
 // --->Functions
@@ -54,6 +54,14 @@
 #define USART0_TX_IRQ		(USART0_UDRE_vect)
 #endif
 
+#ifndef USART0_TX_vect
+/*! IRQ vector of USART transmission complete */
+#define USART0_TXC_IRQ		(USART_TXC_vect)
+#else
+/*! IRQ vector of USART0 transmission complete */
+#define USART0_TXC_IRQ		(USART0_TX_vect)
+#endif
+
 #ifndef USART0_RX_vect
 /*! IRQ vector of USART receiving */
 #define USART0_RX_IRQ		(USART_RXC_vect)
@@ -198,6 +206,14 @@
 #define U2X_0				(U2X0)
 #endif
 
+#ifndef MPCM0
+/*! MPCM flag */
+#define MPCM_0				(MPCM)
+#else
+/*! MPCM0 flag */
+#define MPCM_0				(MPCM0)
+#endif
+
 #ifndef RXEN0
 /*!< RXEN flag */
 #define RXEN_0				(RXEN)
@@ -238,6 +254,14 @@
 #define RXC_0				(RXC0)
 #endif
 
+#ifndef TXC0
+/*! TXC flag */
+#define TXC_0				(TXC)
+#else
+/*! TXC0 flag */
+#define TXC_0				(TXC0)
+#endif
+
 #ifndef UDRE0
 /*! UDRE flag */
 #define UDRE_0				(UDRE)
@@ -358,6 +382,9 @@ typedef struct
    bool IsIrqEnabled;				/*!< IRQ activation flag */
 }SPDescriptor_t;
 
+/*! Callback called when last byte of transmit buffer is sent */
+typedef void (*SPTxCompleteCallback_t)(ESPName_t serialPortName);
+
 /**
  * @brief Serial Port structure
  */
@@ -385,6 +412,7 @@ typedef struct
 		uint8_t bRXC;				/*!< RXC bit */
 		uint8_t bRXCIE;				/*!< RXCIE bit */
 		uint8_t bTXCIE;				/*!< TXCIE bit */
+		uint8_t bTXC;				/*!< TXC bit */
 		uint8_t bUCSZ0;				/*!< UCSZ0 bit */	
 		uint8_t bUCSZ2;				/*!< UCSZ2 bit */
 		uint8_t bUPM0;				/*!< UPM0 bit */
@@ -392,6 +420,7 @@ typedef struct
 		uint8_t bUMSEL;				/*!< UMSE bitL */	
 		uint8_t bUCPOL;				/*!< UCPOL bit */
 		uint8_t bU2X;				/*!< U2X bit */		
+		uint8_t bMPCM;				/*!< MPCM bit */
 		uint8_t bRXEN;				/*!< RXEN bit */	
 		uint8_t bTXEN;				/*!< TXEN bit */
 		uint8_t bUDRE;				/*!< UDRE bit */
@@ -400,6 +429,8 @@ typedef struct
 	SPDescriptor_t *UsartDescriptor;/*!< Port descriptor (pointer) */
 	bool IsPortOpen; 				/*!< Flag for open port */
 	uint8_t ReceivedDataLength;		/*!< Receive data length */
+	/*! Callback of transmission end (NULL - not used) */
+	SPTxCompleteCallback_t TxCompleteCallback;
 }SerialPort_t;
 
 // --->Functions
@@ -503,6 +534,29 @@ void SerialPort_TransmitChar(ESPName_t serialPortName, uint8_t _char);
  */
 void SerialPort_TransmitText(ESPName_t serialPortName, uint8_t* text);
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Transmits block of data without waiting for free space (IRQ mode)
+ * @param    serialPortName : serial port name
+ * @param    data : pointer to the data
+ * @param    length : data length
+ * @retval   Count of bytes queued for sending (rest must be sent later)
+ */
+uint8_t SerialPort_TransmitBlock(ESPName_t serialPortName,
+                                 const uint8_t *data,
+                                 uint8_t length);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Sets callback of transmission end (IRQ mode)
+ * @param    serialPortName : serial port name
+ * @param    callback : callback called from IRQ when last byte left shift
+ *                      register (NULL - not used)
+ * @retval   None
+ */
+void SerialPort_SetTxCompleteCallback(ESPName_t serialPortName,
+                                      SPTxCompleteCallback_t callback);
+
 #endif								/* SERIAL_PORT_H */
 
 /******************* (C) COPYRIGHT 2013 HENIUS *************** END OF FILE ****/
\ No newline at end of file
@@ -49,8 +49,13 @@ typedef struct
  */
 typedef struct
 {
-	/*! Pointer to the frame sending function */
-	void(*SendFrame)(CommProtocolFrame_t* frame);
+	/*! Pointer to the frame sending function (non-blocking, false - frame
+	    not accepted because previous frame is not queued yet, caller keeps
+	    the frame and sends it again later, e.g. in next handler call) */
+	bool(*SendFrame)(CommProtocolFrame_t* frame);
+	/*! Pointer to the function setting callback of transmission end (called
+	    from IRQ when last byte of frame left, NULL - not used) */
+	void(*SetSendCallback)(void(*callback)(void));
 	/*! Pointer to the controller handler function */
 	bool(*Handler)(void);	
 }CommController_t;
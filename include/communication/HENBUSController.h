@@ -29,11 +29,102 @@
 
 // --->Macros and constants
 
-#define HENBUS_DATA_BUFF_SIZE	(100)	/*!< Receive buffer size */
+#ifndef HENBUS_DATA_BUFF_SIZE
+#define HENBUS_DATA_BUFF_SIZE	(100)	/*!< Receive buffer size (max. 255) */
+#endif
 #define HENBUS_SOF				(':')	/*!< Start of Frame character */
 #define HENBUS_EOF              ('#')	/*!< End Of Frame character */
 #define HENBUS_TIMEOUT			(4000)	/*!< Receive timeout (in ms) */
 #define HENBUS_ASCII_CMD_SIZE	(3)		/*!< Frame size in ASCII mode */
+#ifndef HENBUS_FRAME_POOL_SIZE
+/*! Count of frame buffers received and delivered in rotation (power of 2) */
+#define HENBUS_FRAME_POOL_SIZE	(2)
+#endif
+#if HENBUS_FRAME_POOL_SIZE < 2
+#error "HENBUS needs at least 2 frame buffers"
+#endif
+#ifndef HENBUS_CMD_HASH_SIZE
+/*! Slots of command hash table in ASCII mode (power of 2, max. 128, about
+    3 times count of commands for hash without collisions) */
+#define HENBUS_CMD_HASH_SIZE	(64)
+#endif
+#if (HENBUS_CMD_HASH_SIZE & (HENBUS_CMD_HASH_SIZE - 1)) || \
+    HENBUS_CMD_HASH_SIZE > 128
+#error "HENBUS_CMD_HASH_SIZE must be power of 2 (max. 128)"
+#endif
+#ifndef HENBUS_RX_BYTE_BUDGET
+/*! Max. bytes read by one handler call (0 - all received bytes) */
+#define HENBUS_RX_BYTE_BUDGET	(0)
+#endif
+
+// Frame check sequence (CRC of Data field)
+
+#define HENBUS_FCS_CRC8			(0)		/*!< CRC8 (Dallas/Maxim) */
+#define HENBUS_FCS_CRC16		(1)		/*!< CRC-16/CCITT */
+#define HENBUS_FCS_CRC32		(2)		/*!< CRC-32 */
+
+#ifndef HENBUS_FCS
+#define HENBUS_FCS				HENBUS_FCS_CRC8	/*!< Selected CRC type */
+#endif
+
+/*! Size of CRC value (bytes, sent high byte first) */
+#if HENBUS_FCS == HENBUS_FCS_CRC8
+#define HENBUS_FCS_SIZE			(1)
+#elif HENBUS_FCS == HENBUS_FCS_CRC16
+#define HENBUS_FCS_SIZE			(2)
+#elif HENBUS_FCS == HENBUS_FCS_CRC32
+#define HENBUS_FCS_SIZE			(4)
+#else
+#error "Unknown HENBUS_FCS"
+#endif
+
+// Framing of frames in binary mode
+
+#define HENBUS_FRAMING_SOF_EOF	(0)		/*!< SOF and EOF characters */
+/*! COBS encoded fields (without SOF and EOF) ended by zero delimiter */
+#define HENBUS_FRAMING_COBS		(1)
+
+#ifndef HENBUS_FRAMING
+#define HENBUS_FRAMING			HENBUS_FRAMING_SOF_EOF	/*!< Selected framing */
+#endif
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS && !defined(COMM_BINARY_MODE)
+#error "HENBUS COBS framing needs binary mode"
+#endif
+
+// Sequence header (pipelined requests)
+//
+// Host sends up to HENBUS_WINDOW_SIZE requests (DATA, sequence numbers
+// modulo 32) without waiting for answers. Every request is answered with
+// its sequence number: by frame sent during delivery of request (DATA) or
+// by ACK. CRC covers header (address, sequence header, command and data
+// size) and is sent also in frames without data. Request with invalid CRC is
+// answered by NAK without change of window (damaged header is not taken as
+// other request). Repeated request (or NAK of answer) is not delivered
+// again, cached answer is sent instead. Frames of type NONE are delivered
+// without window (frames sent outside delivery have this type). Bit 5 of
+// header is zero (header is never SOF or EOF character).
+
+// RAM cost of window: answers are cached in (HENBUS_WINDOW_SIZE + 1) slots
+// of HENBUS_FRAME_MAX_LENGTH bytes (plus few bytes of slot state). With
+// default binary frame (HENBUS_DATA_BUFF_SIZE 100, CRC8 - 107 bytes) window
+// of 4 takes 5 * 107 = 535 bytes, window of 8 takes 963 bytes (half of RAM
+// of ATmega328P).
+
+#ifndef HENBUS_WINDOW_SIZE
+/*! Max. count of outstanding requests (power of 2, max. 16, 0 - no sequence
+    header and no answer cache) */
+#define HENBUS_WINDOW_SIZE		(0)
+#endif
+#if (HENBUS_WINDOW_SIZE & (HENBUS_WINDOW_SIZE - 1)) || HENBUS_WINDOW_SIZE > 16
+#error "HENBUS_WINDOW_SIZE must be power of 2 (max. 16)"
+#endif
+
+#define HENBUS_SEQ_DATA			(0x00)	/*!< Request or its answer */
+#define HENBUS_SEQ_ACK			(0x40)	/*!< Answer without data */
+#define HENBUS_SEQ_NAK			(0x80)	/*!< Frame with invalid CRC */
+#define HENBUS_SEQ_NONE			(0xC0)	/*!< Frame outside window */
+#define HENBUS_SEQ_TYPE_MASK	(0xC0)	/*!< Type bits of sequence header */
+#define HENBUS_SEQ_NUMBER_MASK	(0x1F)	/*!< Sequence number bits */
 
 // Fields indexes
 
@@ -54,6 +145,19 @@
 /*! Index of end of Address field */
 #define HENBUS_ADDRESS_END_INDEX		(HENBUS_ADDRESS_START_INDEX + \
                                          HENBUS_ADDRES_LENGTH - 1)
+/*! Size of sequence header field */
+#if !HENBUS_WINDOW_SIZE
+#define HENBUS_SEQ_LENGTH		(0)
+#elif defined(COMM_BINARY_MODE)
+#define HENBUS_SEQ_LENGTH		(1)
+#else
+#define HENBUS_SEQ_LENGTH		(2)
+#endif
+/*! Index of beginning of sequence header field */
+#define HENBUS_SEQ_START_INDEX	(HENBUS_ADDRESS_END_INDEX + 1)
+/*! Index of end of sequence header field */
+#define HENBUS_SEQ_END_INDEX	(HENBUS_SEQ_START_INDEX + \
+                                 HENBUS_SEQ_LENGTH - 1)
 /*! Size of command field */
 #ifdef COMM_BINARY_MODE
 #define HENBUS_CMD_LENGTH		(1)
@@ -61,7 +165,7 @@
 #define HENBUS_CMD_LENGTH		(HENBUS_ASCII_CMD_SIZE)
 #endif
 /*! Index of beginning of Command field */
-#define HENBUS_CMD_START_INDEX	(HENBUS_ADDRESS_END_INDEX + 1)
+#define HENBUS_CMD_START_INDEX	(HENBUS_SEQ_END_INDEX + 1)
 /*! Index of end of Command field */
 #define HENBUS_CMD_END_INDEX	(HENBUS_CMD_START_INDEX + \
                                  HENBUS_CMD_LENGTH - 1)
@@ -82,9 +186,62 @@
 #define HENBUS_DATA_OR_CRC_START_INDEX	(HENBUS_DATA_SIZE_END_INDEX + 1)
 /*! Size of CRC field */
 #ifdef COMM_BINARY_MODE
-#define HENBUS_CRC_LENGTH		(1)
+#define HENBUS_CRC_LENGTH		(HENBUS_FCS_SIZE)
+#else
+#define HENBUS_CRC_LENGTH		(HENBUS_FCS_SIZE * 2)
+#endif
+
+/*! Max. size of Data field */
+#ifdef COMM_BINARY_MODE
+#define HENBUS_DATA_MAX_LENGTH	(HENBUS_DATA_BUFF_SIZE)
+#else
+#define HENBUS_DATA_MAX_LENGTH	(HENBUS_DATA_BUFF_SIZE * 2)
+#endif
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+/*! Max. length of fields without SOF and EOF */
+#define HENBUS_FIELDS_MAX_LENGTH	(HENBUS_DATA_OR_CRC_START_INDEX - 2 + \
+                                     HENBUS_DATA_MAX_LENGTH + \
+                                     HENBUS_CRC_LENGTH)
+/*! Max. count of COBS code bytes */
+#define HENBUS_COBS_OVERHEAD	(HENBUS_FIELDS_MAX_LENGTH / 254 + 1)
+/*! Max. frame length with delimiter (transmit buffer size, max. 255) */
+#define HENBUS_FRAME_MAX_LENGTH	(HENBUS_FIELDS_MAX_LENGTH + \
+                                 HENBUS_COBS_OVERHEAD + 1)
 #else
-#define HENBUS_CRC_LENGTH		(2)
+/*! Max. frame length from SOF to EOF (transmit buffer size, max. 255) */
+#define HENBUS_FRAME_MAX_LENGTH	(HENBUS_DATA_OR_CRC_START_INDEX + \
+                                 HENBUS_DATA_MAX_LENGTH + HENBUS_CRC_LENGTH)
+#endif
+#if HENBUS_FRAME_MAX_LENGTH > 255
+#error "HENBUS_DATA_BUFF_SIZE too big for transmit buffer"
+#endif
+
+// --->Types
+
+/**
+ * @brief Address filter of receiver (frames of other nodes are skipped)
+ */
+typedef struct
+{
+	uint8_t Address;					/*!< Node address */
+	/*! Compared bits of address (0xFF - whole address, 0 - every address) */
+	uint8_t Mask;
+	bool IsBroadcastEnabled;			/*!< Broadcast frames reception flag */
+	uint8_t BroadcastAddress;			/*!< Broadcast address */
+}HENBUSAddressFilter_t;
+
+/*! Handler of received command */
+typedef void (*HENBUSCommandHandler_t)(CommProtocolFrame_t* frame);
+
+#ifndef COMM_BINARY_MODE
+/**
+ * @brief Command of ASCII mode (entry of command table in program memory)
+ */
+typedef struct
+{
+	uint8_t Name[HENBUS_ASCII_CMD_SIZE];	/*!< Command name (without NUL) */
+	HENBUSCommandHandler_t Handler;			/*!< Command handler */
+}HENBUSCommand_t;
 #endif
 
 /* Declaration section -------------------------------------------------------*/
@@ -97,16 +254,53 @@
 * @param    wdFrame : watchdog frame from PC
 * @param    wdAnswerFrame : watchdog answer frame
 * @param    serialPortName : serial port name
-* @param    frameCallback : frame receive callback
+* @param    addressFilter : address filter (NULL - frames of every address)
+* @param    frameCallback : frame receive callback (called after reading of
+*           received bytes, frame stays valid until next frame is delivered)
 * @param    taskInterval : function repetition interval
 * @retval   Structure of controller
 */
 CommController_t HENBUSCtrl_Init(const CommProtocolFrame_t* wdTestFrame,
                                  const CommProtocolFrame_t* wdAnswerFrame,
                                  ESPName_t serialPortName,
+                                 const HENBUSAddressFilter_t* addressFilter,
                                  void (*FrameCallback)(CommProtocolFrame_t*),
                                  uint16_t taskInterval);
 
+#ifdef COMM_BINARY_MODE
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Sets command table (frames of commands without handler are passed
+*           to frame callback)
+* @param    commandTable : 256 handlers indexed by CommandID in program
+*           memory (NULL - all frames passed to frame callback)
+* @retval   None
+*/
+void HENBUSCtrl_SetCommandTable(const HENBUSCommandHandler_t* commandTable);
+#else
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Sets command table (frames of commands without handler are passed
+*           to frame callback), perfect hash of names is searched
+* @param    commands : commands in program memory (NULL - all frames passed
+*           to frame callback)
+* @param    commandAmount : count of commands
+* @retval   Table set flag (false - hash not found, previous table kept)
+*/
+bool HENBUSCtrl_SetCommandTable(const HENBUSCommand_t* commands,
+                                uint8_t commandAmount);
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Command handler sending watchdog answer frame (with command table
+*           watchdog frame is answered only by this handler, answer rejected
+*           by busy transmitter is sent again by controller handler)
+* @param    frame : received watchdog frame
+* @retval   None
+*/
+void HENBUSCtrl_WatchdogHandler(CommProtocolFrame_t* frame);
+
 #endif								/* HENBUS_CONTROLLER_H */
 
 /******************* (C) COPYRIGHT 2013 HENIUS *************** KONIEC PLIKU ***/
\ No newline at end of file
@@ -16,14 +16,19 @@
 
 // --->System files
 
+#include <chrono>
+#include <cstdint>
 #include <gtest/gtest.h>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
 using namespace ::testing;
 
 /* Macros, constants and definitions section ---------------------------------*/
 
 /*! Macro to create test class */
 #define TEST_CLASS(className) \
-	TEST_CLASS_NAME : public Test
+	className##_class : public Test
 
 /*! Macro to create unit test with fixture class*/
 #define UNIT_TEST_F(className, testName)	\
@@ -50,4 +55,23 @@ using namespace ::testing;
 			Values(__VA_ARGS__)); \
 	TEST_P(testName##_class, testName)
 
+/* Function section ----------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reads timestamp counter (cycles) or time in nanoseconds
+ *           (for benchmarks)
+ * @param    None
+ * @retval   Timestamp
+ */
+static inline uint64_t ReadCycles(void)
+{
+#ifdef __x86_64__
+	return __rdtsc();
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
 /******************* (C) COPYRIGHT 2020 HENIUS *************** END OF FILE ****/
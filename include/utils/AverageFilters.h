@@ -28,7 +28,50 @@
 /*! Size of filter buffer 2 */
 #define AVG_FILTER2_SIZE	(1 << AVG_FILTER_SCALE)		
 #define AVGF1_SF			(8)				/*!< Scaling factor of filter 1 */
-#define MF_SIZE				(5)
+#define MF_SIZE				(5)				/*!< Default median filter window */
+#define AVG_FILTER3_MIN_SCALE	(1)			/*!< Min. window of filter 3: 2 */
+#define AVG_FILTER3_MAX_SCALE	(8)			/*!< Max. window of filter 3: 256 */
+
+// --->Macros
+
+/*! Checks the window scale of filter 3 */
+#define AVG_FILTER3_IS_SCALE_VALID(scale) \
+	((scale) >= AVG_FILTER3_MIN_SCALE && (scale) <= AVG_FILTER3_MAX_SCALE)
+/*! Initializer of filter 3 with window of (1 << scale) samples */
+#define AVG_FILTER3_INIT(buffer, scale)		{ 0, (scale), 0, (buffer) }
+/*! Defines filter 3 'name' with its own zeroed buffer of (1 << scale)
+    samples (also at local scope, invalid scale gives negative array size) */
+#define AVG_FILTER3_DEFINE(name, scale) \
+	enum { name##_Scale = (scale) }; \
+	int16_t name##_Buffer[AVG_FILTER3_IS_SCALE_VALID(scale) ? \
+	                      1 << (scale) : -1] = { 0 }; \
+	AvgFilter3_t name = AVG_FILTER3_INIT(name##_Buffer, scale)
+/*! Filters sample with filter 3 'name' defined with AVG_FILTER3_DEFINE */
+#define AVG_FILTER3(name, currentSample) \
+	AverageFilter3_Scaled((currentSample), &(name), name##_Scale)
+/*! Defines bank of filters 1 'name' for 'channels' channels */
+#define AVG_FILTER1_BANK_DEFINE(name, channels, timeConstant) \
+	int32_t name##_PreviousSamples[channels] = { 0 }; \
+	AvgFilter1Bank_t name = \
+		{ (channels), (timeConstant), name##_PreviousSamples }
+/*! Defines bank of filters 3 'name' for 'channels' channels with zeroed
+    sums and buffer (invalid scale gives negative array size) */
+#define AVG_FILTER_BANK_DEFINE(name, channels, scale) \
+	enum { name##_Scale = (scale) }; \
+	int32_t name##_Sums[channels] = { 0 }; \
+	int16_t name##_Buffer[AVG_FILTER3_IS_SCALE_VALID(scale) ? \
+	                      (1 << (scale)) * (channels) : -1] = { 0 }; \
+	AvgFilterBank_t name = \
+		{ (channels), 0, (scale), name##_Sums, name##_Buffer }
+/*! Filters scan with bank 'name' defined with AVG_FILTER_BANK_DEFINE */
+#define AVG_FILTER_BANK(name, samples, results) \
+	AverageFilterBank_Scaled((samples), (results), &(name), name##_Scale)
+/*! Defines median filter 'name' with window of 'size' samples (odd) filled
+    with zeros (even size gives negative array size) */
+#define MEDIAN_FILTER_DEFINE(name, size) \
+	int16_t name##_History[((size) & 1) ? (size) : -1] = { 0 }; \
+	int16_t name##_Sorted[size] = { 0 }; \
+	MedianFilter_t name = { (size), 0, name##_History, name##_Sorted }
 
 // --->Types
 
@@ -51,6 +94,56 @@ typedef struct
 	int16_t Buffer[AVG_FILTER2_SIZE];		/*!< Sample buffer */				
 }AvgFilter2_t;
 
+/**
+ * @brief Configuration data for filter 3 (filter 2 with configurable window)
+ */
+typedef struct  
+{
+	uint8_t Index;							/*!< Sample index */
+	uint8_t Scale;							/*!< Window size (power of 2) */
+	int32_t PreviousSum;					/*!< Previous sample sum */
+	int16_t *Buffer;						/*!< Buffer of (1 << Scale) items */
+}AvgFilter3_t;
+
+/**
+ * @brief Configuration data for bank of filters 1 (one per ADC channel)
+ */
+typedef struct
+{
+	uint8_t ChannelAmount;					/*!< Count of channels */
+	uint8_t TimeConstant;					/*!< Time constant */
+	int32_t *PreviousSamples;				/*!< Previous samples */
+}AvgFilter1Bank_t;
+
+/**
+ * @brief Configuration data for bank of filters 3 (one per ADC channel)
+ *
+ * All channels share the window and the sample index. Samples of one scan
+ * are kept in a row of Buffer: Buffer[Index * ChannelAmount + channel].
+ */
+typedef struct
+{
+	uint8_t ChannelAmount;					/*!< Count of channels */
+	uint8_t Index;							/*!< Sample index */
+	uint8_t Scale;							/*!< Window size (power of 2) */
+	int32_t *Sums;							/*!< Sample sums of channels */
+	int16_t *Buffer;						/*!< Sample buffer */
+}AvgFilterBank_t;
+
+/**
+ * @brief Configuration data for median filter
+ *
+ * Window is kept twice: in order of arrival (to know the oldest sample) and
+ * sorted (to get the median).
+ */
+typedef struct
+{
+	uint8_t Size;							/*!< Window size */
+	uint8_t Index;							/*!< Index of the oldest sample */
+	int16_t *History;						/*!< Samples in order of arrival */
+	int16_t *Sorted;						/*!< Samples in ascending order */
+}MedianFilter_t;
+
 /* Declaration section -------------------------------------------------------*/
 
 // --->Functions
@@ -73,6 +166,164 @@ int32_t AverageFilter1(int32_t currentSample, AvgFilter1_t *filter);
  */
 uint16_t AverageFilter2(uint16_t currentSample, AvgFilter2_t *filter);
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes average filter #3
+ * @param    *filter : pointer to the filter configuration structure
+ * @param    *buffer : sample buffer of (1 << scale) items
+ * @param    scale : window size as power of 2 (1 - 8)
+ * @retval   None
+ */
+void AverageFilter3_Init(AvgFilter3_t *filter, int16_t *buffer, uint8_t scale);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Average filter #3 (moving average of 2^Scale samples)
+ *
+ *           Scale is read from the filter, so on AVR the final shift is a
+ *           loop of Scale 32-bit shifts (about 7 cycles each). Filters defined
+ *           with AVG_FILTER3_DEFINE should use AVG_FILTER3 macro instead.
+ * @param    currentSample : current sample
+ * @param    *filter : pointer to the filter configuration structure
+ * @retval   Average of all samples
+ */
+uint16_t AverageFilter3(uint16_t currentSample, AvgFilter3_t *filter);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Average filter #3 with window scale known at compile time
+ *
+ *           Constant scale lets the compiler replace the shift loop with
+ *           byte moves.
+ * @param    currentSample : current sample
+ * @param    *filter : pointer to the filter configuration structure
+ * @param    scale : window size as power of 2 (equal to filter->Scale)
+ * @retval   Average of all samples
+ */
+static inline uint16_t AverageFilter3_Scaled(uint16_t currentSample,
+                                             AvgFilter3_t *filter,
+                                             const uint8_t scale)
+{
+	// Average calculation
+	filter->PreviousSum = filter->PreviousSum + (int32_t)currentSample -
+	                      filter->Buffer[filter->Index];
+
+	// Inserting sample into buffer
+	filter->Buffer[filter->Index++] = currentSample;
+	filter->Index &= (uint8_t)((1 << scale) - 1);
+
+	return filter->PreviousSum >> scale;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes bank of average filters #1
+ * @param    *bank : pointer to the bank configuration structure
+ * @param    *previousSamples : table of previous samples (one per channel)
+ * @param    channelAmount : count of channels
+ * @param    timeConstant : time constant of filters
+ * @retval   None
+ */
+void AverageFilter1Bank_Init(AvgFilter1Bank_t *bank,
+                             int32_t *previousSamples,
+                             uint8_t channelAmount,
+                             uint8_t timeConstant);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Average filter #1 for all channels of ADC scan
+ * @param    *samples : current samples (one per channel)
+ * @param    *results : filtered values (one per channel)
+ * @param    *bank : pointer to the bank configuration structure
+ * @retval   None
+ */
+void AverageFilter1Bank(const volatile uint16_t *samples,
+                        int32_t *results,
+                        AvgFilter1Bank_t *bank);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes bank of average filters #3
+ * @param    *bank : pointer to the bank configuration structure
+ * @param    *sums : table of sums (one per channel)
+ * @param    *buffer : sample buffer of ((1 << scale) * channelAmount) items
+ * @param    channelAmount : count of channels
+ * @param    scale : window size as power of 2 (1 - 8)
+ * @retval   None
+ */
+void AverageFilterBank_Init(AvgFilterBank_t *bank,
+                            int32_t *sums,
+                            int16_t *buffer,
+                            uint8_t channelAmount,
+                            uint8_t scale);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Average filter #3 for all channels of ADC scan
+ *
+ *           Scale is read from the bank, so on AVR every result needs a loop
+ *           of Scale 32-bit shifts. Banks defined with AVG_FILTER_BANK_DEFINE
+ *           should use AVG_FILTER_BANK macro instead.
+ * @param    *samples : current samples (one per channel)
+ * @param    *results : averages (one per channel, can be equal to samples)
+ * @param    *bank : pointer to the bank configuration structure
+ * @retval   None
+ */
+void AverageFilterBank(const volatile uint16_t *samples,
+                       uint16_t *results,
+                       AvgFilterBank_t *bank);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Average filter #3 for all channels of ADC scan with window scale
+ *           known at compile time
+ * @param    *samples : current samples (one per channel)
+ * @param    *results : averages (one per channel, can be equal to samples)
+ * @param    *bank : pointer to the bank configuration structure
+ * @param    scale : window size as power of 2 (equal to bank->Scale)
+ * @retval   None
+ */
+static inline void AverageFilterBank_Scaled(const volatile uint16_t *samples,
+                                            uint16_t *results,
+                                            AvgFilterBank_t *bank,
+                                            const uint8_t scale)
+{
+	int16_t *oldest = &bank->Buffer[(uint16_t)bank->Index *
+	                                bank->ChannelAmount];
+	int32_t *sum = bank->Sums;
+	uint16_t currentSample;
+	uint8_t channel;
+
+	// Whole row of the oldest samples is replaced with the current scan
+	for (channel = bank->ChannelAmount; channel; channel--)
+	{
+		currentSample = *samples++;
+		*sum += (int32_t)currentSample - *oldest;
+		*oldest++ = currentSample;
+		*results++ = *sum++ >> scale;
+	}
+
+	bank->Index = (bank->Index + 1) & (uint8_t)((1 << scale) - 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes median filter
+ * @param    *filter : pointer to the filter configuration structure
+ * @param    initialValue : value which fills the window
+ * @retval   None
+ */
+void MedianFilter_Init(MedianFilter_t *filter, int16_t initialValue);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Median filter (cost proportional to window size, no sorting)
+ * @param    currentSample : current sample
+ * @param    *filter : pointer to the filter configuration structure
+ * @retval   Median of the window
+ */
+int16_t MedianFilter(int16_t currentSample, MedianFilter_t *filter);
+
 #endif								/* AVERAGE_FILTERS_H_ */
 
 /******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
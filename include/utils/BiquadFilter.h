@@ -0,0 +1,202 @@
+/**
+ *******************************************************************************
+ * @file     BiquadFilter.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Fixed-point biquad IIR filters (header file)
+ *
+ *           Cascade of second order sections in direct form II transposed:
+ *
+ *           y = b0 * x + s1
+ *           s1 = b1 * x - a1 * y + s2
+ *           s2 = b2 * x - a2 * y
+ *
+ *           Coefficients are kept in program memory and may be shared by
+ *           many channels, each channel has its own state in RAM.
+ *
+ *           Q15 variant: samples Q15 (int16_t), coefficients Q14 (range
+ *           -2.0 - 2.0), state Q29 in int32_t (range -4.0 - 4.0).
+ *           Q31 variant: samples Q31 (int32_t), coefficients Q30, state Q61
+ *           in int64_t. Outputs of sections are saturated; sections with
+ *           gain above 1 need input scaled down to keep state in range.
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  BIQUAD_FILTER_H_
+#define  BIQUAD_FILTER_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+#include <avr/pgmspace.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define BIQUAD_Q15_COEFF_SHIFT	(14)		/*!< Fraction bits of Q15 coeff. */
+#define BIQUAD_Q31_COEFF_SHIFT	(30)		/*!< Fraction bits of Q31 coeff. */
+
+// --->Macros
+
+/*! Converts constant coefficient (-2.0 - 2.0) to Q15 filter format (Q14) */
+#define BIQUAD_Q15_COEFF(value)	((int16_t)((value) * \
+	(1L << BIQUAD_Q15_COEFF_SHIFT) + ((value) < 0 ? -0.5 : 0.5)))
+
+/*! Converts constant coefficient (-2.0 - 2.0) to Q31 filter format (Q30) */
+#define BIQUAD_Q31_COEFF(value)	((int32_t)((value) * \
+	(1L << BIQUAD_Q31_COEFF_SHIFT) + ((value) < 0 ? -0.5 : 0.5)))
+
+/*! Defines channel of Q15 filter 'name' with coefficients 'coeffs' */
+#define BIQUAD_Q15_DEFINE(name, coeffs) \
+	BiquadQ15State_t name##_States[sizeof(coeffs) / \
+	                               sizeof(BiquadQ15Coeffs_t)] = { { 0 } }; \
+	BiquadQ15_t name = { coeffs, name##_States, \
+	                     sizeof(coeffs) / sizeof(BiquadQ15Coeffs_t) }
+
+/*! Defines channel of Q31 filter 'name' with coefficients 'coeffs' */
+#define BIQUAD_Q31_DEFINE(name, coeffs) \
+	BiquadQ31State_t name##_States[sizeof(coeffs) / \
+	                               sizeof(BiquadQ31Coeffs_t)] = { { 0 } }; \
+	BiquadQ31_t name = { coeffs, name##_States, \
+	                     sizeof(coeffs) / sizeof(BiquadQ31Coeffs_t) }
+
+// --->Types
+
+/**
+ * @brief Coefficients of Q15 second order section (a0 = 1)
+ */
+typedef struct
+{
+	int16_t B0;								/*!< Coefficient b0 (Q14) */
+	int16_t B1;								/*!< Coefficient b1 (Q14) */
+	int16_t B2;								/*!< Coefficient b2 (Q14) */
+	int16_t A1;								/*!< Coefficient a1 (Q14) */
+	int16_t A2;								/*!< Coefficient a2 (Q14) */
+}BiquadQ15Coeffs_t;
+
+/**
+ * @brief State of Q15 second order section
+ */
+typedef struct
+{
+	int32_t S1;								/*!< First delay element (Q29) */
+	int32_t S2;								/*!< Second delay element (Q29) */
+}BiquadQ15State_t;
+
+/**
+ * @brief Channel of Q15 biquad cascade
+ */
+typedef struct
+{
+	const BiquadQ15Coeffs_t *Coeffs;		/*!< Sections (program memory) */
+	BiquadQ15State_t *States;				/*!< States of sections */
+	uint8_t SectionAmount;					/*!< Count of sections */
+}BiquadQ15_t;
+
+/**
+ * @brief Coefficients of Q31 second order section (a0 = 1)
+ */
+typedef struct
+{
+	int32_t B0;								/*!< Coefficient b0 (Q30) */
+	int32_t B1;								/*!< Coefficient b1 (Q30) */
+	int32_t B2;								/*!< Coefficient b2 (Q30) */
+	int32_t A1;								/*!< Coefficient a1 (Q30) */
+	int32_t A2;								/*!< Coefficient a2 (Q30) */
+}BiquadQ31Coeffs_t;
+
+/**
+ * @brief State of Q31 second order section
+ */
+typedef struct
+{
+	int64_t S1;								/*!< First delay element (Q61) */
+	int64_t S2;								/*!< Second delay element (Q61) */
+}BiquadQ31State_t;
+
+/**
+ * @brief Channel of Q31 biquad cascade
+ */
+typedef struct
+{
+	const BiquadQ31Coeffs_t *Coeffs;		/*!< Sections (program memory) */
+	BiquadQ31State_t *States;				/*!< States of sections */
+	uint8_t SectionAmount;					/*!< Count of sections */
+}BiquadQ31_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes channel of Q15 biquad cascade
+ * @param    *filter : pointer to the filter channel structure
+ * @param    *coeffs : table of section coefficients (program memory)
+ * @param    *states : table of section states ('sectionAmount' items)
+ * @param    sectionAmount : count of sections
+ * @retval   None
+ */
+void BiquadQ15_Init(BiquadQ15_t *filter,
+                    const BiquadQ15Coeffs_t *coeffs,
+                    BiquadQ15State_t *states,
+                    uint8_t sectionAmount);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Clears state of Q15 biquad cascade
+ * @param    *filter : pointer to the filter channel structure
+ * @retval   None
+ */
+void BiquadQ15_Reset(BiquadQ15_t *filter);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Q15 biquad cascade
+ * @param    currentSample : current sample (Q15)
+ * @param    *filter : pointer to the filter channel structure
+ * @retval   Filtered sample (Q15)
+ */
+int16_t BiquadQ15(int16_t currentSample, BiquadQ15_t *filter);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes channel of Q31 biquad cascade
+ * @param    *filter : pointer to the filter channel structure
+ * @param    *coeffs : table of section coefficients (program memory)
+ * @param    *states : table of section states ('sectionAmount' items)
+ * @param    sectionAmount : count of sections
+ * @retval   None
+ */
+void BiquadQ31_Init(BiquadQ31_t *filter,
+                    const BiquadQ31Coeffs_t *coeffs,
+                    BiquadQ31State_t *states,
+                    uint8_t sectionAmount);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Clears state of Q31 biquad cascade
+ * @param    *filter : pointer to the filter channel structure
+ * @retval   None
+ */
+void BiquadQ31_Reset(BiquadQ31_t *filter);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Q31 biquad cascade
+ * @param    currentSample : current sample (Q31)
+ * @param    *filter : pointer to the filter channel structure
+ * @retval   Filtered sample (Q31)
+ */
+int32_t BiquadQ31(int32_t currentSample, BiquadQ31_t *filter);
+
+#endif								/* BIQUAD_FILTER_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
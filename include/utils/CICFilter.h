@@ -0,0 +1,84 @@
+/**
+ *******************************************************************************
+ * @file     CICFilter.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    CIC decimation filter (header file)
+ *
+ *           Filter of order N and decimation rate R has gain R^N, so its
+ *           output has log2(R^N) more bits than the input. Intermediate
+ *           values use modulo 2^32 arithmetic, so for 10-bit input
+ *           10 + N * ceil(log2(R)) must not exceed 32 (e.g. N = 3, R = 64
+ *           gives 28, N = 4 is allowed up to R = 32).
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  CIC_FILTER_H_
+#define  CIC_FILTER_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define CIC_MAX_ORDER		(4)				/*!< Maximal filter order */
+#define CIC_INPUT_BITS		(10)			/*!< Maximal input sample bits */
+#define CIC_REGISTER_BITS	(32)			/*!< Bits of filter registers */
+
+// --->Types
+
+/**
+ * @brief Configuration data of CIC decimation filter
+ */
+typedef struct
+{
+	uint8_t Order;							/*!< Count of stages */
+	uint8_t Rate;							/*!< Decimation rate */
+	uint8_t Shift;							/*!< Right shift of output */
+	uint8_t Phase;							/*!< Sample in decimation period */
+	uint32_t Integrators[CIC_MAX_ORDER];	/*!< Integrator stages */
+	uint32_t Delays[CIC_MAX_ORDER];			/*!< Previous comb inputs */
+}CICFilter_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes CIC filter
+ * @param    *filter : pointer to the filter configuration structure
+ * @param    order : count of integrator and comb stages (1 - CIC_MAX_ORDER)
+ * @param    rate : decimation rate (input samples per output sample)
+ * @param    shift : right shift of output (log2(rate^order) - extra bits)
+ * @retval   Initialization status (false - order reduced to the largest one
+ *           with CIC_INPUT_BITS + order * ceil(log2(rate)) not exceeding
+ *           CIC_REGISTER_BITS, or rate equal to 0 changed to 1)
+ */
+bool CICFilter_Init(CICFilter_t *filter,
+                    uint8_t order,
+                    uint8_t rate,
+                    uint8_t shift);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    CIC decimation filter
+ * @param    currentSample : current sample
+ * @param    *filter : pointer to the filter configuration structure
+ * @param    *result : output sample (written once per decimation period)
+ * @retval   Output status (true - new output sample)
+ */
+bool CICFilter(uint16_t currentSample, CICFilter_t *filter, uint16_t *result);
+
+#endif								/* CIC_FILTER_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
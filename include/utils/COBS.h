@@ -0,0 +1,113 @@
+/**
+ *******************************************************************************
+ * @file     COBS.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Consistent Overhead Byte Stuffing (header file)
+ *
+ *           Encoded data contains no zero bytes, so zero can be used as
+ *           frame delimiter. Data is split into blocks, each block starts
+ *           with code byte (count of block bytes + 1) and ends with implicit
+ *           zero (except block of 254 bytes and last block). Overhead is
+ *           one byte per 254 bytes of data.
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  COBS_H_
+#define  COBS_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define COBS_DELIMITER		(0x00)			/*!< Frame delimiter */
+#define COBS_MAX_CODE		(0xFF)			/*!< Code of block without zero */
+
+// --->Macros
+
+/*! Max. length of encoded data (without delimiter) */
+#define COBS_MAX_LENGTH(length)	((length) + (length) / 254 + 1)
+
+// --->Types
+
+/**
+ * @brief Decoder state (for decoding byte by byte)
+ */
+typedef struct
+{
+	uint8_t Code;							/*!< Code of current block */
+	uint8_t Left;							/*!< Bytes left in current block */
+}COBSDecoder_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Encodes data block
+ * @param    *result : encoded data (COBS_MAX_LENGTH(length) bytes, can be
+ *           the same buffer as data if data starts at least
+ *           COBS_MAX_LENGTH(length) - length bytes after result)
+ * @param    *data : input data
+ * @param    length : length of input data
+ * @retval   Length of encoded data (without delimiter)
+ */
+uint16_t COBS_Encode(uint8_t *result, const uint8_t *data, uint16_t length);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Decodes data block (up to delimiter or end of data)
+ * @param    *result : decoded data (can be the same buffer as data)
+ * @param    *data : encoded data
+ * @param    length : length of encoded data
+ * @retval   Length of decoded data
+ */
+uint16_t COBS_Decode(uint8_t *result, const uint8_t *data, uint16_t length);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Decodes one byte of encoded data
+ * @param    *decoder : decoder state
+ * @param    data : encoded byte (other than delimiter)
+ * @retval   Decoded byte (-1 - code byte without decoded byte)
+ */
+int16_t COBS_DecodeByte(COBSDecoder_t *decoder, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Starts decoding of new frame (after delimiter)
+ * @param    *decoder : decoder state
+ * @retval   None
+ */
+static inline void COBS_DecoderInit(COBSDecoder_t *decoder)
+{
+	// First block has no zero before
+	decoder->Code = COBS_MAX_CODE;
+	decoder->Left = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Checks if last block of frame is complete (before delimiter)
+ * @param    *decoder : decoder state
+ * @retval   Complete block flag
+ */
+static inline bool COBS_IsDecoderComplete(const COBSDecoder_t *decoder)
+{
+	return !decoder->Left;
+}
+
+#endif								/* COBS_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -2,9 +2,9 @@
  *******************************************************************************
  * @file     FIFO.h
  * @author   HENIUS (Paweł Witak)
- * @version  1.01.001
+ * @version  1.1.2
  * @date     19/03/2011
- * @brief    Obsługa kolejki FIFO (plik nagłówkowy)
+ * @brief    FIFO queue (header file)
  *******************************************************************************
  *
  * <h2><center>COPYRIGHT 2011 HENIUS</center></h2>
@@ -13,40 +13,279 @@
 #ifndef  FIFO_H
 #define  FIFO_H
 
-/* Sekcja include ------------------------------------------------------------*/
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
 
-// Pliki systemowe
 #include <stdbool.h>
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Maximal queue capacity (greatest power of 2 in 8-bit counters) */
+#define FIFO_MAX_SIZE		(0x80)
+
+// --->Macros
 
-/* Sekcja stałych, makr i definicji ------------------------------------------*/
+/*! Checks if the queue size is a power of 2 (required by index masking) */
+#define FIFO_IS_SIZE_VALID(size)	((size) != 0 && !((size) & ((size) - 1)))
+/*! Defines buffer 'name' of FIFO queue (size: power of 2, max. 128) */
+#define FIFO_BUFFER_DEFINE(name, size) \
+	typedef char name##_SizeCheck[(FIFO_IS_SIZE_VALID(size) && \
+	                               (size) <= FIFO_MAX_SIZE) ? 1 : -1]; \
+	uint8_t name[size]
 
-// --->Stałe
+// --->Types
 
-// --->Makra
+#ifdef FIFO_STATS_ENABLED
+/**
+ * @brief Occupancy statistics of FIFO queue (FIFO_STATS_ENABLED only)
+ */
+typedef struct
+{
+	uint8_t PeakCount;						/*!< Greatest count of items */
+	uint32_t AddedCount;					/*!< Count of added items */
+	uint32_t DroppedCount;					/*!< Count of dropped items */
+	uint32_t FullTime;						/*!< Ticks with full queue */
+}FIFOStats_t;
+#endif
 
-// ---> Typy
 /**
- * @brief Konfiguracja kolejki FIFO
+ * @brief FIFO queue (ring buffer)
+ *
+ * Capacity of the queue is the greatest power of 2 not bigger than the size
+ * passed to FIFO_Init (max. FIFO_MAX_SIZE), so the indexes can be wrapped
+ * with a bit mask. Rest of the buffer stays unused (e.g. 255 gives 128 items
+ * and 100 gives 64), so buffers should be defined with FIFO_BUFFER_DEFINE,
+ * which rejects other sizes at compile time.
  */
 typedef struct
 {
-	uint8_t Count;							/*!< Liczba elementów w kolejce */
-	uint8_t Size;							/*!< Rozmiar kolejki */
-	bool IsQueueFull;						/*!< Status zapełnienia kolejki */
-	uint8_t *Buffer;						/*!< Wskaźnik do bufora kolejki */
+	uint8_t Count;							/*!< Count of items in queue */
+	uint8_t Size;							/*!< Queue capacity */
+	bool IsQueueFull;						/*!< Queue full flag */
+	uint8_t *Buffer;						/*!< Pointer to the queue buffer */
+	uint8_t Head;							/*!< Index of next write */
+	uint8_t Tail;							/*!< Index of next read */
+	uint8_t Mask;							/*!< Index mask (Size - 1) */
+#ifdef FIFO_STATS_ENABLED
+	FIFOStats_t Stats;						/*!< Occupancy statistics */
+#endif
 }FIFO_t;
 
-/* Sekcja deklaracji ---------------------------------------------------------*/
+/**
+ * @brief Contiguous region of the queue buffer
+ */
+typedef struct
+{
+	uint8_t *Data;							/*!< Beginning of region */
+	uint8_t Length;							/*!< Length of region */
+}FIFOSpan_t;
+
+/**
+ * @brief Single-producer/single-consumer FIFO queue
+ *
+ * Head is written only by the producer and Tail only by the consumer (both
+ * are free-running and wrapped with Mask on buffer access), so the queue
+ * can be shared between IRQ and main loop without disabling interrupts.
+ * Capacity is limited to FIFO_MAX_SIZE to keep Head - Tail unambiguous.
+ */
+typedef struct
+{
+	uint8_t Head;							/*!< Write counter (producer) */
+	uint8_t Tail;							/*!< Read counter (consumer) */
+	uint8_t Size;							/*!< Queue capacity */
+	uint8_t Mask;							/*!< Index mask (Size - 1) */
+	uint8_t *Buffer;						/*!< Pointer to the queue buffer */
+}SPSCFIFO_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
 
-// Inicjalizacja kolejki
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes the queue.
+ * @param    *fifo : pointer to the queue
+ * @param    *buffer : pointer to the queue buffer
+ * @param    size : size of buffer (power of 2, max. FIFO_MAX_SIZE - other
+ *                  sizes are rounded down to the greatest fitting power of 2)
+ * @retval   None
+ */
 void FIFO_Init(FIFO_t *fifo, uint8_t *buffer, uint8_t size);
 
-// Dodawanie elementu do kolejki
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Adds item to the end of queue.
+ * @param    *fifo : pointer to the queue
+ * @param    byte : added item
+ * @retval   None
+ */
 void FIFO_Add(FIFO_t *fifo, uint8_t byte);
 
-// Pobieranie elementu z kolejki
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets item from the beginning of queue.
+ * @param    *fifo : pointer to the queue
+ * @retval   Item (0 if queue is empty)
+ */
 uint8_t FIFO_Get(FIFO_t *fifo);
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Adds block of items to the end of queue.
+ * @param    *fifo : pointer to the queue
+ * @param    *data : pointer to the added items
+ * @param    length : count of added items
+ * @retval   Count of items which were added (rest didn't fit)
+ */
+uint8_t FIFO_AddBlock(FIFO_t *fifo, const uint8_t *data, uint8_t length);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets block of items from the beginning of queue.
+ * @param    *fifo : pointer to the queue
+ * @param    *data : pointer to the output buffer
+ * @param    length : maximal count of items to get
+ * @retval   Count of items which were got
+ */
+uint8_t FIFO_GetBlock(FIFO_t *fifo, uint8_t *data, uint8_t length);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets items from the beginning of queue without removing them.
+ *
+ *           Items are returned as (up to) two regions of the queue buffer,
+ *           the second one is used when the items wrap over the buffer end.
+ *           Unused region has zero length. Items stay valid until they are
+ *           removed with FIFO_Consume.
+ * @param    *fifo : pointer to the queue
+ * @param    spans : table of two regions to fill
+ * @retval   Count of items in both regions
+ */
+uint8_t FIFO_PeekSpan(FIFO_t *fifo, FIFOSpan_t spans[2]);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Removes items from the beginning of queue.
+ * @param    *fifo : pointer to the queue
+ * @param    length : count of items to remove
+ * @retval   None
+ */
+void FIFO_Consume(FIFO_t *fifo, uint8_t length);
+
+#ifdef FIFO_STATS_ENABLED
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets occupancy statistics of queue.
+ * @param    *fifo : pointer to the queue
+ * @param    *stats : pointer to the statistics copy
+ * @retval   None
+ */
+void FIFO_GetStats(FIFO_t *fifo, FIFOStats_t *stats);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Resets occupancy statistics of queue.
+ * @param    *fifo : pointer to the queue
+ * @retval   None
+ */
+void FIFO_ResetStats(FIFO_t *fifo);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Counts time with full queue (to be called periodically).
+ * @param    *fifo : pointer to the queue
+ * @retval   None
+ */
+void FIFO_StatsTick(FIFO_t *fifo);
+#else
+#define FIFO_ResetStats(fifo)					/*!< Statistics disabled */
+#define FIFO_StatsTick(fifo)					/*!< Statistics disabled */
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reads counter written by the other side of queue
+ *
+ *           Buffer accesses following this read can't be moved before it.
+ * @param    *counter : pointer to the counter
+ * @retval   Counter value
+ */
+static inline uint8_t FIFO_LoadAcquire(const uint8_t *counter)
+{
+#ifdef __AVR__
+	// Byte access is atomic, only the compiler can reorder it
+	uint8_t value = *(const volatile uint8_t *)counter;
+
+	__asm__ __volatile__ ("" ::: "memory");
+
+	return value;
+#else
+	return __atomic_load_n(counter, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Writes counter read by the other side of queue
+ *
+ *           Buffer accesses preceding this write can't be moved after it.
+ * @param    *counter : pointer to the counter
+ * @param    value : new counter value
+ * @retval   None
+ */
+static inline void FIFO_StoreRelease(uint8_t *counter, uint8_t value)
+{
+#ifdef __AVR__
+	__asm__ __volatile__ ("" ::: "memory");
+	*(volatile uint8_t *)counter = value;
+#else
+	__atomic_store_n(counter, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes the single-producer/single-consumer queue.
+ *
+ *           Must be called before producer and consumer are started.
+ * @param    *fifo : pointer to the queue
+ * @param    *buffer : pointer to the queue buffer
+ * @param    size : size of buffer (power of 2, max. FIFO_MAX_SIZE - other
+ *                  sizes are rounded down to the greatest fitting power of 2)
+ * @retval   None
+ */
+void SPSCFIFO_Init(SPSCFIFO_t *fifo, uint8_t *buffer, uint8_t size);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Adds item to the end of queue (producer side only).
+ * @param    *fifo : pointer to the queue
+ * @param    byte : added item
+ * @retval   Operation status (false - queue is full)
+ */
+bool SPSCFIFO_Add(SPSCFIFO_t *fifo, uint8_t byte);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets item from the beginning of queue (consumer side only).
+ * @param    *fifo : pointer to the queue
+ * @param    *byte : pointer to the read item
+ * @retval   Operation status (false - queue is empty)
+ */
+bool SPSCFIFO_Get(SPSCFIFO_t *fifo, uint8_t *byte);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Gets count of items in queue (from any side).
+ * @param    *fifo : pointer to the queue
+ * @retval   Count of items
+ */
+uint8_t SPSCFIFO_Count(SPSCFIFO_t *fifo);
+
 #endif										/* FIFO_H */
 
-/******************* (C) COPYRIGHT 2011 HENIUS *************** KONIEC PLIKU ***/
+/******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
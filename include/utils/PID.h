@@ -2,11 +2,11 @@
  *******************************************************************************
  * @file     PID.h
  * @author   HENIUS (Paweł Witak)
- * @version  1.01.001
+ * @version  1.1.2
  * @date     25-05-2011
- * @brief    Regulatora cyfrowy PID (plik nagłówkowy)
+ * @brief    Digital PID controller (header file)
  *
- * 			 Ten plik został napisany w oparciu o kod Atmela (AVR221).
+ * 			 This file is based on Atmel code (AVR221).
  *******************************************************************************
  *
  * <h2><center>COPYRIGHT 2011 HENIUS</center></h2>
@@ -15,48 +15,193 @@
 #ifndef  PID_H_
 #define  PID_H_
 
-/* Sekcja include ------------------------------------------------------------*/
+/* Include section -----------------------------------------------------------*/
 
-// Pliki systemowe
+// --->System files
 
-/* Sekcja stałych, makr i definicji ------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
 
-// Stałe
-/*! Stała skalująca wartość nastawy regulatora */
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Scaling factor of controller gains (2 ^ PID_SCALING_SHIFT) */
 #define PID_SCALING_FACTOR	(128)
-// Maksymalne wartości zmiennych
-/*! Maksymalna wartość INT */
+/*! Shift equal to division by PID_SCALING_FACTOR */
+#define PID_SCALING_SHIFT	(7)
+// Maximal values of variables
+/*! Maximal value of INT */
 #define MAX_INT         	(INT16_MAX)
-/*! Maksymalna wartość LONG */
+/*! Maximal value of LONG */
 #define MAX_LONG        	(INT32_MAX)
-/*! Maksymalna wartość współczynnika członu całkującego */
+/*! Maximal value of integral term */
 #define MAX_I_TERM      	(MAX_LONG / 2)
+/*! Maximal count of controllers in bank */
+#define PID_BANK_MAX_SIZE	(16)
+/*! Cascade source: set value given by caller */
+#define PID_BANK_EXTERNAL	(0)
+/*! Limit of velocity-form controller output sum (output range, scaled) */
+#define PID_VELOCITY_MAX_SUM	((int32_t)MAX_INT << PID_SCALING_SHIFT)
+
+// --->Macros
 
-/* Sekcja deklaracji ---------------------------------------------------------*/
+/*! Cascade source: output of controller 'index' of the same bank */
+#define PID_BANK_SOURCE(index)	((index) + 1)
 
-// --->Zmienne
+/*! Defines bank 'name' of 'amount' controllers (gains and sources to set) */
+#define PID_BANK_DEFINE(name, amount) \
+	typedef char name##_SizeCheck[(amount) <= PID_BANK_MAX_SIZE ? 1 : -1]; \
+	int16_t name##_P_Factors[amount]; \
+	int16_t name##_I_Factors[amount]; \
+	int16_t name##_D_Factors[amount]; \
+	uint8_t name##_CascadeSources[amount]; \
+	int16_t name##_LastProcessValues[amount]; \
+	int32_t name##_SumErrors[amount]; \
+	int16_t name##_MaxErrors[amount]; \
+	int32_t name##_MaxSumErrors[amount]; \
+	uint8_t name##_Order[amount]; \
+	PIDBank_t name = { (amount), name##_P_Factors, name##_I_Factors, \
+	                   name##_D_Factors, name##_CascadeSources, \
+	                   name##_LastProcessValues, name##_SumErrors, \
+	                   name##_MaxErrors, name##_MaxSumErrors, name##_Order }
+
+// --->Types
 
-// --->Typy
 /**
- * @brief Konfiguracja i charakterystyka regulatora PID
+ * @brief Configuration and state of PID controller
  */
 typedef struct
 {
-	int16_t LastProcessValue;	    /*!< Ostatnia wartość procesowa */
-	int32_t SumError;				/*!< Suma błędów */
-	int16_t P_Factor;				/*!< Współczynnik członu proporcjonalnego */
-	int16_t I_Factor;				/*!< Współczynnik członu całkującego */
-	int16_t D_Factor;				/*!< Współczynnik członu różniczkującego */
-	int16_t MaxError;				/*!< Maksymalny dopuszczalny błąd */
-	int32_t MaxSumError;		    /*!< Maksymalna wartość SumError */
+	int16_t LastProcessValue;	    /*!< Last process value */
+	int32_t SumError;				/*!< Sum of errors */
+	int16_t P_Factor;				/*!< Proportional gain */
+	int16_t I_Factor;				/*!< Integral gain */
+	int16_t D_Factor;				/*!< Derivative gain */
+	int16_t MaxError;				/*!< Maximal error (set by PID_Init) */
+	int32_t MaxSumError;		    /*!< Maximal SumError (set by PID_Init) */
 }PID_t;
 
-// --->Funkcje
-// Inicjalizacja regulatora PID
+/**
+ * @brief Bank of PID controllers (structure of arrays, one item per loop)
+ */
+typedef struct
+{
+	uint8_t ControllerAmount;		/*!< Count of controllers */
+	int16_t *P_Factors;				/*!< Proportional gains */
+	int16_t *I_Factors;				/*!< Integral gains */
+	int16_t *D_Factors;				/*!< Derivative gains */
+	uint8_t *CascadeSources;		/*!< Set value sources (PID_BANK_SOURCE) */
+	int16_t *LastProcessValues;		/*!< Last process values */
+	int32_t *SumErrors;				/*!< Sums of errors */
+	int16_t *MaxErrors;				/*!< Maximal errors */
+	int32_t *MaxSumErrors;			/*!< Maximal sums of errors */
+	uint8_t *Order;					/*!< Update order (set by PID_BankInit) */
+}PIDBank_t;
+
+/**
+ * @brief Configuration and state of velocity-form (incremental) PID
+ *        controller, gains are scaled by PID_SCALING_FACTOR
+ *
+ *        du = Kp * (e - e') + Ki * e + Kd * (d - d')
+ *        d = d' + (-(y - y') - d') / 2^FilterShift
+ *        v = U' + du
+ *        U = v + Kb * (sat(v) - v)
+ *
+ *        Kb = PID_SCALING_FACTOR (1.0) stops integration at once when
+ *        output is saturated, Kb = 0 disables anti-windup.
+ */
+typedef struct
+{
+	int16_t P_Factor;				/*!< Proportional gain */
+	int16_t I_Factor;				/*!< Integral gain */
+	int16_t D_Factor;				/*!< Derivative gain */
+	int16_t B_Factor;				/*!< Back-calculation gain (0 - 1.0) */
+	uint8_t FilterShift;			/*!< Derivative filter time constant */
+	int16_t MinOutput;				/*!< Minimal output (actuator limit) */
+	int16_t MaxOutput;				/*!< Maximal output (actuator limit) */
+	int16_t LastError;				/*!< Last error */
+	int16_t LastProcessValue;	    /*!< Last process value */
+	int32_t Derivative;				/*!< Filtered derivative (scaled) */
+	int32_t OutputSum;				/*!< Unsaturated output (scaled) */
+}PIDVelocity_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes PID controller (gains must be set before) and
+ *           precomputes error limits, so PID_Handler does not divide
+ * @param    *pid : pointer to the controller configuration structure
+ * @retval   None
+ */
 void PID_Init(PID_t *pid);
-// Funkcja obsługi regulatora
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    PID controller
+ * @param    setValue : set value
+ * @param    processValue : measured (process) value
+ * @param    *pid : pointer to the controller configuration structure
+ * @retval   Controller output
+ */
 int16_t PID_Handler(int16_t setValue, int16_t processValue, PID_t *pid);
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes bank of PID controllers (gains and cascade sources
+ *           must be set before) and resolves update order of cascades
+ * @param    *bank : pointer to the bank structure
+ * @retval   Initialization status (false - invalid source or cycle)
+ */
+bool PID_BankInit(PIDBank_t *bank);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Bank of PID controllers - updates all loops in dependency order,
+ *           output of source loop is used directly as set value of cascaded
+ *           loop in the same call
+ * @param    *setValues : set values (ignored for cascaded loops)
+ * @param    *processValues : measured (process) values
+ * @param    *outputs : controller outputs
+ * @param    *bank : pointer to the bank structure
+ * @retval   None
+ */
+void PID_BankHandler(const int16_t *setValues,
+                     const int16_t *processValues,
+                     int16_t *outputs,
+                     PIDBank_t *bank);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Initializes velocity-form PID controller (gains and limits must
+ *           be set before), starts without bump from given operating point
+ * @param    *pid : pointer to the controller configuration structure
+ * @param    setValue : current set value
+ * @param    processValue : current measured (process) value
+ * @param    output : current controller output
+ * @retval   None
+ */
+void PIDVelocity_Init(PIDVelocity_t *pid,
+                      int16_t setValue,
+                      int16_t processValue,
+                      int16_t output);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Velocity-form PID controller with filtered derivative (on
+ *           measurement) and back-calculation anti-windup
+ * @param    setValue : set value
+ * @param    processValue : measured (process) value
+ * @param    *pid : pointer to the controller configuration structure
+ * @retval   Controller output (MinOutput - MaxOutput)
+ */
+int16_t PIDVelocity_Handler(int16_t setValue,
+                            int16_t processValue,
+                            PIDVelocity_t *pid);
+
 #endif								/* PID_H_ */
 
-/******************* (C) COPYRIGHT 2011 HENIUS ************** KONIEC PLIKU ****/
+/******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,98 @@
+/**
+ *******************************************************************************
+ * @file     TypedFIFO.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    FIFO queues of any item type (header file)
+ *
+ *           TYPED_FIFO_DEFINE generates queue type and inline functions for
+ *           the given item type, e.g.:
+ *
+ *           TYPED_FIFO_DEFINE(SampleFIFO, uint16_t, 16)
+ *
+ *           gives type SampleFIFO_t and functions SampleFIFO_Init,
+ *           SampleFIFO_Add, SampleFIFO_Get and SampleFIFO_Count. Items are
+ *           copied by assignment, so each type has its own code path.
+ *           Queue has single-producer/single-consumer semantics of
+ *           SPSCFIFO_t.
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  TYPED_FIFO_H
+#define  TYPED_FIFO_H
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --->User files
+
+#include "FIFO.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Macros
+
+/*! Generates queue of 'size' items of 'type' (size: power of 2, max. 128) */
+#define TYPED_FIFO_DEFINE(name, type, size) \
+\
+typedef char name##_SizeCheck[(FIFO_IS_SIZE_VALID(size) && \
+                               (size) <= FIFO_MAX_SIZE) ? 1 : -1]; \
+\
+typedef struct \
+{ \
+	uint8_t Head;							/*!< Write counter (producer) */ \
+	uint8_t Tail;							/*!< Read counter (consumer) */ \
+	type Buffer[size];						/*!< Queue buffer */ \
+}name##_t; \
+\
+static inline void name##_Init(name##_t *fifo) \
+{ \
+	fifo->Head = 0; \
+	fifo->Tail = 0; \
+} \
+\
+static inline bool name##_Add(name##_t *fifo, type item) \
+{ \
+	uint8_t head = fifo->Head; \
+\
+	if ((uint8_t)(head - FIFO_LoadAcquire(&fifo->Tail)) >= (size)) \
+	{ \
+		return false; \
+	} \
+\
+	fifo->Buffer[head & ((size) - 1)] = item; \
+	FIFO_StoreRelease(&fifo->Head, head + 1); \
+\
+	return true; \
+} \
+\
+static inline bool name##_Get(name##_t *fifo, type *item) \
+{ \
+	uint8_t tail = fifo->Tail; \
+\
+	if (FIFO_LoadAcquire(&fifo->Head) == tail) \
+	{ \
+		return false; \
+	} \
+\
+	*item = fifo->Buffer[tail & ((size) - 1)]; \
+	FIFO_StoreRelease(&fifo->Tail, tail + 1); \
+\
+	return true; \
+} \
+\
+static inline uint8_t name##_Count(name##_t *fifo) \
+{ \
+	return FIFO_LoadAcquire(&fifo->Head) - FIFO_LoadAcquire(&fifo->Tail); \
+}
+
+#endif										/* TYPED_FIFO_H */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
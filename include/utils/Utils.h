@@ -52,7 +52,7 @@ uint8_t CRC8(uint8_t *dataIn, uint16_t size);
 /*----------------------------------------------------------------------------*/
 /**
 * @brief    Converts byte to the ASCII HEX
-* @param    result : ASCI HEX value pointer
+* @param    result : ASCI HEX value pointer (3 bytes, ended with 0)
 * @param    byte : converted byte
 * @retval   None
 */
@@ -61,12 +61,12 @@ void ByteToAsciiHex(uint8_t* result, uint8_t byte);
 /*----------------------------------------------------------------------------*/
 /**
 * @brief    Converts bytes to the ASCII HEX
-* @param    result : ASCI HEX value pointer
+* @param    result : ASCI HEX value pointer (2 * length + 1 bytes, ended with 0)
 * @param    byte : converted byte
 * @param    length : length of input table
 * @retval   None
 */
-void BytesToAsciiHex(uint8_t* result, uint8_t* bytes, uint8_t length);
+void BytesToAsciiHex(uint8_t* result, uint8_t* bytes, uint16_t length);
 
 /*----------------------------------------------------------------------------*/
 /**
@@ -84,6 +84,16 @@ uint8_t HexToByte(uint8_t hex);
 */
 uint8_t AsciiHexToByte(uint8_t* asciHex);
 
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Converts ASCII HEX values to the bytes
+* @param    result : output bytes pointer
+* @param    asciiHex : ASCII HEX values (2 * length characters)
+* @param    length : count of output bytes
+* @retval   None
+*/
+void AsciiHexToBytes(uint8_t *result, const uint8_t *asciiHex, uint16_t length);
+
 #endif 										/* UTILS_H_ */
 
 /******************* (C) COPYRIGHT 2012 HENIUS *************** END OF FILE ****/
\ No newline at end of file
@@ -0,0 +1,84 @@
+/**
+ *******************************************************************************
+ * @file     CRC16.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    CRC-16/CCITT calculation (header file)
+ *
+ *           CRC-16/CCITT (CCITT-FALSE): polynomial X^16 + X^12 + X^5 + 1
+ *           (0x1021), not reflected, initial value 0xFFFF, no final XOR.
+ *
+ *           Table-driven (256-entry table in program memory), one byte per
+ *           step: crc = CRC16_Init(); crc = CRC16_Update(crc, byte); ...
+ *           result = CRC16_Final(crc);
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  CRC16_H_
+#define  CRC16_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define CRC16_POLYNOMIAL	(0x1021)		/*!< Polynomial */
+#define CRC16_INIT_VALUE	(0xFFFF)		/*!< Initial value of CRC */
+#define CRC16_XOR_OUT		(0x0000)		/*!< Final XOR value */
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with one byte
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+uint16_t CRC16_Update(uint16_t crc, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with data block
+ * @param    crc : current CRC value (CRC16_Init() for new block)
+ * @param    *data : input data
+ * @param    size : size of input data
+ * @retval   Updated CRC value
+ */
+uint16_t CRC16_Block(uint16_t crc, const uint8_t *data, uint16_t size);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Starts incremental CRC calculation
+ * @param    None
+ * @retval   Initial CRC value
+ */
+static inline uint16_t CRC16_Init(void)
+{
+	return CRC16_INIT_VALUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Finishes incremental CRC calculation
+ * @param    crc : current CRC value
+ * @retval   Final CRC value
+ */
+static inline uint16_t CRC16_Final(uint16_t crc)
+{
+	return crc ^ CRC16_XOR_OUT;
+}
+
+#endif								/* CRC16_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,84 @@
+/**
+ *******************************************************************************
+ * @file     CRC32.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    CRC-32 calculation (header file)
+ *
+ *           CRC-32 (IEEE 802.3): polynomial 0x04C11DB7, reflected
+ *           (0xEDB88320), initial value 0xFFFFFFFF, final XOR 0xFFFFFFFF.
+ *
+ *           Table-driven (256-entry table in program memory), one byte per
+ *           step: crc = CRC32_Init(); crc = CRC32_Update(crc, byte); ...
+ *           result = CRC32_Final(crc);
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  CRC32_H_
+#define  CRC32_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define CRC32_POLYNOMIAL	(0xEDB88320UL)	/*!< Reflected polynomial */
+#define CRC32_INIT_VALUE	(0xFFFFFFFFUL)	/*!< Initial value of CRC */
+#define CRC32_XOR_OUT		(0xFFFFFFFFUL)	/*!< Final XOR value */
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with one byte
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+uint32_t CRC32_Update(uint32_t crc, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with data block
+ * @param    crc : current CRC value (CRC32_Init() for new block)
+ * @param    *data : input data
+ * @param    size : size of input data
+ * @retval   Updated CRC value
+ */
+uint32_t CRC32_Block(uint32_t crc, const uint8_t *data, uint16_t size);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Starts incremental CRC calculation
+ * @param    None
+ * @retval   Initial CRC value
+ */
+static inline uint32_t CRC32_Init(void)
+{
+	return CRC32_INIT_VALUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Finishes incremental CRC calculation
+ * @param    crc : current CRC value
+ * @retval   Final CRC value
+ */
+static inline uint32_t CRC32_Final(uint32_t crc)
+{
+	return crc ^ CRC32_XOR_OUT;
+}
+
+#endif								/* CRC32_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
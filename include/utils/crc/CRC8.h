@@ -0,0 +1,131 @@
+/**
+ *******************************************************************************
+ * @file     CRC8.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    CRC8 calculation (header file)
+ *
+ *           Dallas/Maxim CRC8: polynomial X^8 + X^5 + X^4 + 1 (0x31),
+ *           reflected (0x8C), initial value 0x00. Used by HENBUS and 1-Wire.
+ *
+ *           Strategy is selected at build time with CRC8_STRATEGY:
+ *           - CRC8_STRATEGY_BITWISE: bit by bit loop (no table),
+ *           - CRC8_STRATEGY_NIBBLE: 16-byte table, two lookups per byte,
+ *           - CRC8_STRATEGY_TABLE: 256-byte table, one lookup per byte.
+ *           Tables are kept in program memory. Defining CRC8_ALL_STRATEGIES
+ *           compiles all of them (e.g. for benchmarks).
+ *
+ *           Incremental calculation (e.g. in receive parsers):
+ *           crc = CRC8_Init(); crc = CRC8_Update(crc, byte); ...
+ *           result = CRC8_Final(crc);
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#ifndef  CRC8_H_
+#define  CRC8_H_
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+#define CRC8_STRATEGY_BITWISE	(0)			/*!< Bit by bit loop */
+#define CRC8_STRATEGY_NIBBLE	(1)			/*!< 16-byte table */
+#define CRC8_STRATEGY_TABLE		(2)			/*!< 256-byte table */
+
+#ifndef CRC8_STRATEGY
+#define CRC8_STRATEGY		CRC8_STRATEGY_NIBBLE	/*!< Selected strategy */
+#endif
+
+#define CRC8_POLYNOMIAL		(0x8C)			/*!< Reflected polynomial 0x31 */
+#define CRC8_INIT_VALUE		(0x00)			/*!< Initial value of CRC */
+
+// --->Macros
+
+#if CRC8_STRATEGY == CRC8_STRATEGY_BITWISE
+/*! Updates CRC with one byte (selected strategy) */
+#define CRC8_Update			CRC8_UpdateBitwise
+#elif CRC8_STRATEGY == CRC8_STRATEGY_NIBBLE
+/*! Updates CRC with one byte (selected strategy) */
+#define CRC8_Update			CRC8_UpdateNibble
+#elif CRC8_STRATEGY == CRC8_STRATEGY_TABLE
+/*! Updates CRC with one byte (selected strategy) */
+#define CRC8_Update			CRC8_UpdateTable
+#else
+#error "Unknown CRC8_STRATEGY"
+#endif
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Functions
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with one byte - bit by bit loop
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+uint8_t CRC8_UpdateBitwise(uint8_t crc, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with one byte - 16-byte table
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+uint8_t CRC8_UpdateNibble(uint8_t crc, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with one byte - 256-byte table
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+uint8_t CRC8_UpdateTable(uint8_t crc, uint8_t data);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Updates CRC with data block (selected strategy)
+ * @param    crc : current CRC value (CRC8_INIT_VALUE for new block)
+ * @param    *data : input data
+ * @param    size : size of input data
+ * @retval   Updated CRC value
+ */
+uint8_t CRC8_Block(uint8_t crc, const uint8_t *data, uint16_t size);
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Starts incremental CRC calculation
+ * @param    None
+ * @retval   Initial CRC value
+ */
+static inline uint8_t CRC8_Init(void)
+{
+	return CRC8_INIT_VALUE;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Finishes incremental CRC calculation
+ * @param    crc : current CRC value
+ * @retval   Final CRC value
+ */
+static inline uint8_t CRC8_Final(uint8_t crc)
+{
+	return crc;
+}
+
+#endif								/* CRC8_H_ */
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -14,6 +14,7 @@
 
 // --->System files
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <avr/interrupt.h>
@@ -71,7 +72,9 @@ void ADC_StopConv(void)
 ISR(ADC_vect)
 {
 	static uint8_t oversamplingIndex = 0;
+	static bool isDecimated = false;
 	uint8_t oversamplingFactor = 0;
+	uint16_t sample;
 		
 	switch (AdcConfig->Resolution) 
 	{
@@ -81,7 +84,16 @@ ISR(ADC_vect)
 			break;
 		
 		case ADCR_10BIT:
-			AdcConfig->Buffer[ChIdx] = ADC;
+			if (!AdcConfig->Decimators)
+			{
+				AdcConfig->Buffer[ChIdx] = ADC;
+			}
+			// Buffer is updated once per decimation period
+			else if (CICFilter(ADC, &AdcConfig->Decimators[ChIdx], &sample))
+			{
+				AdcConfig->Buffer[ChIdx] = sample;
+				isDecimated = true;
+			}
 			
 			break;
 			
@@ -113,7 +125,16 @@ ISR(ADC_vect)
 		oversamplingIndex++;
 		oversamplingIndex %= oversamplingFactor;		
 		
-		if (oversamplingFactor && !oversamplingIndex) 
+		// With decimators only scans with new outputs are completed
+		if (AdcConfig->Decimators && AdcConfig->Resolution == ADCR_10BIT)
+		{
+			if (isDecimated)
+			{
+				isDecimated = false;
+				AdcConfig->OnCompleted();
+			}
+		}
+		else if (oversamplingFactor && !oversamplingIndex) 
 			AdcConfig->OnCompleted();
 		else
 			AdcConfig->OnCompleted();
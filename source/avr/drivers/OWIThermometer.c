@@ -23,6 +23,7 @@
 #include "OWIMaster.h"
 #include "OWIThermometer.h"
 #include "OWICrc.h"
+#include "CRC8.h"
 
 /* Variable, macros and constants section ------------------------------------*/
 
@@ -137,6 +138,8 @@ static int16_t OWITherm_ConvertTemp(OWIThermoMem_t *thermMem,
 bool OWIThermo_ReadMemory(OWIThermoMem_t *memory, OWIROMCode_t *romId)
 {
 	bool result = false;
+	uint8_t crc = CRC8_Init();
+	uint8_t index;
 	
 	// Bus initialization
 	if (OWIMaster_Init())
@@ -153,10 +156,15 @@ bool OWIThermo_ReadMemory(OWIThermoMem_t *memory, OWIROMCode_t *romId)
 		
 		// Configuration write (depends on sensor type)
 		OWIMaster_SendByte(OWITC_READ_MEM);
-		OWIMaster_ReadBytes(memory->All, sizeof(OWIThermoMem_t));
 		
-		result = !OWI_CalculateCRC(memory->All, sizeof(OWIThermoMem_t)) ?
-			true : false;
+		// Memory read with CRC calculated byte by byte
+		for (index = 0; index < sizeof(OWIThermoMem_t); index++)
+		{
+			memory->All[index] = OWIMaster_ReadByte();
+			crc = CRC8_Update(crc, memory->All[index]);
+		}
+		
+		result = !CRC8_Final(crc) ? true : false;
 	}
 	
 	return result;
@@ -221,6 +229,7 @@ void OWIThermo_Handler(void)
 	static bool readScratchpad = false;	
 	static uint8_t devNumber;
 	static uint8_t byteNumber;	
+	static uint8_t crc;
 	static OWIThermoMem_t thermMem;	
 	uint8_t amountOfDevice = 
 		Thermometers->AmountOfFoundDevices >= Thermometers->MaxAmountOfDevices ?
@@ -288,6 +297,7 @@ void OWIThermo_Handler(void)
 			currStates = OWITS_READ_MEM;
 			OWIMaster_SendByte(OWITC_READ_MEM);
 			byteNumber = 0;
+			crc = CRC8_Init();
 			readScratchpad = false;		
 		
 			break;
@@ -296,16 +306,16 @@ void OWIThermo_Handler(void)
 		case OWITS_READ_MEM:
 			currStates = OWITS_READ_MEM;
 			thermMem.All[byteNumber] = OWIMaster_ReadByte(); 			
+			crc = CRC8_Update(crc, thermMem.All[byteNumber]);
 			byteNumber++;
 			
 			if (byteNumber == sizeof(OWIThermoMem_t))
 			{
 				ThermDelayTimer = ThermoDelay;
 				
-				// CRC calculation
+				// CRC check (calculated while reading)
 				Thermometers->Devices[devNumber].IsExist = 
-					!OWI_CalculateCRC(thermMem.All, sizeof(OWIThermoMem_t)) ? 
-						true : false;
+					!CRC8_Final(crc) ? true : false;
 				
 				if (Thermometers->Devices[devNumber].IsExist)
 				{		
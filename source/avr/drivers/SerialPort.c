@@ -65,11 +65,13 @@ void SerialPort_Init(SPController_t *data)
 	SerialPort[SPN_USART0].Bit.bUCSZ2 = UCSZ2_0;
 	SerialPort[SPN_USART0].Bit.bUCPOL = UCPOL_0;
 	SerialPort[SPN_USART0].Bit.bU2X = U2X_0;
+	SerialPort[SPN_USART0].Bit.bMPCM = MPCM_0;
 	SerialPort[SPN_USART0].Bit.bUSBS = USBS_0;
 	SerialPort[SPN_USART0].Bit.bUPM0 = UPM0_0;
 	SerialPort[SPN_USART0].Bit.bUMSEL = UMSEL_0;
 	SerialPort[SPN_USART0].Bit.bRXCIE = RXCIE_0;
 	SerialPort[SPN_USART0].Bit.bTXCIE = TXCIE_0;
+	SerialPort[SPN_USART0].Bit.bTXC = TXC_0;
 	SerialPort[SPN_USART0].Bit.bRXC = RXC_0;
 	SerialPort[SPN_USART0].Bit.bUDRE = UDRE_0;
 	SerialPort[SPN_USART0].Bit.bUDRIE = UDRIE_0;
@@ -88,11 +90,13 @@ void SerialPort_Init(SPController_t *data)
 	SerialPort[SPN_USART1].Bit.bUCSZ2 = UCSZ12;
 	SerialPort[SPN_USART1].Bit.bUCPOL = UCPOL1;
 	SerialPort[SPN_USART1].Bit.bU2X = U2X1;
+	SerialPort[SPN_USART1].Bit.bMPCM = MPCM1;
 	SerialPort[SPN_USART1].Bit.bUSBS = USBS1;
 	SerialPort[SPN_USART1].Bit.bUPM0 = UPM01;
 	SerialPort[SPN_USART1].Bit.Bit.UMSELbit = UMSEL1;
 	SerialPort[SPN_USART1].Bit.bRXCIE = RXCIE1;
 	SerialPort[SPN_USART1].Bit.bTXCIE = TXCIE1;
+	SerialPort[SPN_USART1].Bit.bTXC = TXC1;
 	SerialPort[SPN_USART1].Bit.bRXC = RXC1;
 	SerialPort[SPN_USART1].Bit.bUDRE = UDRE1;
 	SerialPort[SPN_USART1].Bit.bUDRIE = UDRIE1;
@@ -274,7 +278,7 @@ void SerialPort_SendChar_Irq(ESPName_t serialPortName, uint8_t character)
  */
 int16_t SerialPort_ReceiveChar(ESPName_t serialPortName, uint16_t timeout)
 {
-	uint8_t udr = -1;
+	int16_t udr = -1;
 	uint16_t timer = timeout;
 	bool isDataReady = false;
 	
@@ -314,7 +318,7 @@ int16_t SerialPort_ReceiveChar(ESPName_t serialPortName, uint16_t timeout)
 /*----------------------------------------------------------------------------*/
 int16_t SerialPort_ReceiveChar_Irq(ESPName_t serialPortName, uint16_t timeout)
 {
-	uint8_t udr = -1;
+	int16_t udr = -1;
 	uint16_t timer = timeout;
 	
 	if (IS_SP_EXIST(serialPortName) &&
@@ -442,6 +446,13 @@ void SerialPort_TransmitHandler(ESPName_t serialPortName)
 			tmptail = (SerialPort[serialPortName].TxTail + 1) % SP_TX_BUFF_SIZE;
 			SerialPort[serialPortName].TxTail = tmptail;      
 		
+			// Transmission end flag cleared by writing one, only U2X and
+			// MPCM written back (FE, DOR and UPE must be written as zero)
+			*SerialPort[serialPortName].Register.rUCSRA =
+				(*SerialPort[serialPortName].Register.rUCSRA &
+				 (_BV(SerialPort[serialPortName].Bit.bU2X) |
+				  _BV(SerialPort[serialPortName].Bit.bMPCM))) |
+				_BV(SerialPort[serialPortName].Bit.bTXC);
 			*SerialPort[serialPortName].Register.rUDR = 
 				SerialPort[serialPortName].TxBuffer[tmptail]; 
 		}
@@ -450,6 +461,13 @@ void SerialPort_TransmitHandler(ESPName_t serialPortName)
 			// IRQ deactivation
 			*SerialPort[serialPortName].Register.rUCSRB &= 
 				~_BV(SerialPort[serialPortName].Bit.bUDRIE);         
+			
+			// Waiting for last byte leaving shift register
+			if (SerialPort[serialPortName].TxCompleteCallback)
+			{
+				*SerialPort[serialPortName].Register.rUCSRB |=
+					_BV(SerialPort[serialPortName].Bit.bTXCIE);
+			}
 		}
 	}	
 }
@@ -472,6 +490,45 @@ ISR(USART1_TX_IRQ)
 }
 #endif								/* SPN_USART1 */
 
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Transmission end handler
+ * @param    serialPortName : serial port name
+ * @retval   None
+ */
+static void SerialPort_TxCompleteHandler(ESPName_t serialPortName)
+{
+	if (IS_SP_EXIST(serialPortName))
+	{
+		// IRQ deactivation (flag cleared by hardware)
+		*SerialPort[serialPortName].Register.rUCSRB &= 
+			~_BV(SerialPort[serialPortName].Bit.bTXCIE);
+		
+		if (SerialPort[serialPortName].TxCompleteCallback)
+		{
+			SerialPort[serialPortName].TxCompleteCallback(serialPortName);
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    IRQ handler for USART0 transmission end
+ * @param    None
+ * @retval   None
+ */
+ISR(USART0_TXC_IRQ)
+{
+	SerialPort_TxCompleteHandler(SPN_USART0);
+}
+
+#ifdef SPN_USART1
+ISR(USART1_TXC_IRQ)
+{
+	SerialPort_TxCompleteHandler(SPN_USART1);
+}
+#endif								/* SPN_USART1 */
+
 /*----------------------------------------------------------------------------*/
 void SerialPort_TransmitChar(ESPName_t serialPortName, uint8_t _char)
 {
@@ -494,6 +551,63 @@ void SerialPort_TransmitText(ESPName_t serialPortName, uint8_t* text)
 	}
 }
 
+/*----------------------------------------------------------------------------*/
+uint8_t SerialPort_TransmitBlock(ESPName_t serialPortName,
+                                 const uint8_t *data,
+                                 uint8_t length)
+{
+	uint8_t tmphead, freeSpace, count = 0;
+	
+	if (IS_SP_EXIST(serialPortName) &&
+	    SerialPort[serialPortName].UsartDescriptor->IsIrqEnabled)
+	{
+		tmphead = SerialPort[serialPortName].TxHead;
+		// Free space in buffer (one item stays empty)
+		freeSpace = (uint8_t)(SerialPort[serialPortName].TxTail - tmphead - 1) %
+			SP_TX_BUFF_SIZE;
+		
+		if (length > freeSpace)
+		{
+			length = freeSpace;
+		}
+		
+		for (count = 0; count < length; count++)
+		{
+			tmphead = (tmphead + 1) % SP_TX_BUFF_SIZE;
+			SerialPort[serialPortName].TxBuffer[tmphead] = data[count];
+		}
+		
+		if (count)
+		{
+			// One update of head for whole block
+			SerialPort[serialPortName].TxHead = tmphead;
+			
+			// IRQ activation
+			*SerialPort[serialPortName].Register.rUCSRB |=
+				_BV(SerialPort[serialPortName].Bit.bUDRIE);
+		}
+	}
+	else if (IS_SP_EXIST(serialPortName))
+	{
+		for (count = 0; count < length; count++)
+		{
+			SerialPort_SendChar(serialPortName, data[count]);
+		}
+	}
+	
+	return count;
+}
+
+/*----------------------------------------------------------------------------*/
+void SerialPort_SetTxCompleteCallback(ESPName_t serialPortName,
+                                      SPTxCompleteCallback_t callback)
+{
+	if (IS_SP_EXIST(serialPortName))
+	{
+		SerialPort[serialPortName].TxCompleteCallback = callback;
+	}
+}
+
 /*----------------------------------------------------------------------------*/
 /**
  * @brief    printf support function
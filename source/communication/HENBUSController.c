@@ -2,7 +2,7 @@
  *******************************************************************************
  * @file     HENBUSController.c
  * @author   HENIUS (Pawe Witak)
- * @version  1.1.1
+ * @version  1.1.2
  * @date     23-10-2013
  * @brief    Handler of HENBUS protocol
  *******************************************************************************
@@ -15,15 +15,103 @@
 // --->System files
 
 #include <stdint.h>
-#include <stdio.h>
-#include <avr/io.h>
 #include <string.h>
 
+#include <avr/pgmspace.h>
+
 // --->User files
 
 #include "HENBUSController.h"
 #include "SerialPort.h"
 #include "Utils.h"
+#include "CRC8.h"
+#include "CRC16.h"
+#include "CRC32.h"
+#include "TypedFIFO.h"
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+#include "COBS.h"
+#endif
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Types and macros
+
+#if HENBUS_FCS == HENBUS_FCS_CRC8
+typedef uint8_t HENBUSFCS_t;				/*!< CRC value */
+#define HENBUS_FCS_INIT()			CRC8_Init()
+#define HENBUS_FCS_UPDATE(fcs, data)	CRC8_Update(fcs, data)
+#define HENBUS_FCS_FINAL(fcs)		CRC8_Final(fcs)
+#elif HENBUS_FCS == HENBUS_FCS_CRC16
+typedef uint16_t HENBUSFCS_t;				/*!< CRC value */
+#define HENBUS_FCS_INIT()			CRC16_Init()
+#define HENBUS_FCS_UPDATE(fcs, data)	CRC16_Update(fcs, data)
+#define HENBUS_FCS_FINAL(fcs)		CRC16_Final(fcs)
+#else
+typedef uint32_t HENBUSFCS_t;				/*!< CRC value */
+#define HENBUS_FCS_INIT()			CRC32_Init()
+#define HENBUS_FCS_UPDATE(fcs, data)	CRC32_Update(fcs, data)
+#define HENBUS_FCS_FINAL(fcs)		CRC32_Final(fcs)
+#endif
+
+#ifdef COMM_BINARY_MODE
+#define HENBUS_CHAR_BITS			(8)	/*!< Value bits in one character */
+#define HENBUS_CHARS_PER_BYTE		(1)	/*!< Characters of one data byte */
+/*! Appends character to value of field (multi-byte CRC) */
+#define HENBUS_CHAR_VALUE(value, character) \
+	(((value) << HENBUS_CHAR_BITS) | (character))
+#else
+#define HENBUS_CHAR_BITS			(4)	/*!< Value bits in one character */
+#define HENBUS_CHARS_PER_BYTE		(2)	/*!< Characters of one data byte */
+/*! Appends character (ASCII HEX) to value of field */
+#define HENBUS_CHAR_VALUE(value, character) \
+	(((value) << HENBUS_CHAR_BITS) | HexToByte(character))
+#endif
+
+/**
+ * @brief States of frame receiver
+ */
+typedef enum
+{
+	HENBUS_RX_SOF,						/*!< Waiting for SOF */
+	HENBUS_RX_ADDRESS,					/*!< Address field */
+	HENBUS_RX_SEQUENCE,					/*!< Sequence header field */
+	HENBUS_RX_COMMAND,					/*!< Command field */
+	HENBUS_RX_DATA_SIZE,				/*!< Data size field */
+	HENBUS_RX_DATA,						/*!< Data field */
+	HENBUS_RX_CRC,						/*!< CRC field */
+	HENBUS_RX_EOF,						/*!< Waiting for EOF */
+	HENBUS_RX_SKIP						/*!< Data and CRC of other node */
+}EHENBUSRxState_t;
+
+/*! Queue of pointers to frame buffers */
+TYPED_FIFO_DEFINE(HENBUSFrameFIFO, CommProtocolFrame_t*, HENBUS_FRAME_POOL_SIZE)
+
+#if HENBUS_WINDOW_SIZE
+/**
+ * @brief States of window slot
+ */
+typedef enum
+{
+	HENBUS_SLOT_FREE,					/*!< No request */
+	HENBUS_SLOT_PENDING,				/*!< Request waiting for answer */
+	HENBUS_SLOT_ANSWERED				/*!< Answer cached */
+}EHENBUSSlotState_t;
+
+/**
+ * @brief Slot of window (request and its serialized answer)
+ */
+typedef struct
+{
+	uint8_t Frame[HENBUS_FRAME_MAX_LENGTH];	/*!< Serialized answer */
+	uint8_t Length;						/*!< Length of answer */
+	uint8_t Sequence;					/*!< Sequence number of request */
+	EHENBUSSlotState_t State;			/*!< State of slot */
+	bool IsQueued;						/*!< Answer waiting for serial port */
+}HENBUSSlot_t;
+
+/*! Queue of slots to transmit */
+TYPED_FIFO_DEFINE(HENBUSSlotFIFO, HENBUSSlot_t*, HENBUS_WINDOW_SIZE * 2)
+#endif
 
 /* Variable section ----------------------------------------------------------*/
 
@@ -31,338 +119,952 @@
 CommProtocolFrame_t WatchdogTestFrame;
 /*! Response frame of power supply */
 CommProtocolFrame_t WatchdogAnswerFrame;
+/*! Watchdog answer not accepted yet (retried by handler) */
+bool IsWatchdogPending;
 ESPName_t SerialPortName;			/*! Serial port name */
 CommController_t Controller;		/*! Communication controller */
-/*! Data buffer */
-uint8_t DataBuffer[HENBUS_DATA_BUFF_SIZE];
+/*! Data buffers of frame pool */
+uint8_t DataBuffers[HENBUS_FRAME_POOL_SIZE][HENBUS_DATA_BUFF_SIZE];
 #ifndef COMM_BINARY_MODE
-/*! Table with received command */
-uint8_t CurrentCommand[HENBUS_ASCII_CMD_SIZE + 1];
+/*! Tables with received commands */
+uint8_t Commands[HENBUS_FRAME_POOL_SIZE][HENBUS_ASCII_CMD_SIZE + 1];
 #endif
-/*! Currently received frame */
-CommProtocolFrame_t CurrentFrame =
-{
-#ifndef COMM_BINARY_MODE	
-	.CommandName = CurrentCommand,
-#endif	
-	.Data        = DataBuffer
-};
+/*! Pool of frames (received and delivered in rotation) */
+CommProtocolFrame_t Frames[HENBUS_FRAME_POOL_SIZE];
+/*! Currently received frame (NULL - no free frame) */
+CommProtocolFrame_t *ReceivingFrame;
+/*! Last delivered frame (kept until next frame is delivered) */
+CommProtocolFrame_t *DeliveredFrame;
+HENBUSFrameFIFO_t FreeFrames;		/*! Frames ready to receive */
+HENBUSFrameFIFO_t ReadyFrames;		/*! Received frames to deliver */
 /*! Pointer to frame received callback */
 void (*FrameReceivedCallback)(CommProtocolFrame_t*);
+/*! Address filter of received frames */
+HENBUSAddressFilter_t AddressFilter;
+#ifdef COMM_BINARY_MODE
+/*! Handlers indexed by CommandID (program memory, NULL - not used) */
+const HENBUSCommandHandler_t *CommandTable;
+#else
+/*! Commands of hash table (program memory, NULL - not used) */
+const HENBUSCommand_t *CommandTable;
+/*! Slots of hash table (command index + 1, 0 - empty slot) */
+uint8_t CommandSlots[HENBUS_CMD_HASH_SIZE];
+uint8_t CommandHashSeed;			/*! Multiplier of hash function */
+#endif
 /*! Timeout (protocol handler repetitions) */
 uint16_t TimeoutTime;
+#if HENBUS_WINDOW_SIZE
+/*! Slots of window and slot of frames outside window (last one) */
+HENBUSSlot_t Slots[HENBUS_WINDOW_SIZE + 1];
+/*! Sequence headers of frame pool */
+uint8_t FrameSequences[HENBUS_FRAME_POOL_SIZE];
+HENBUSSlotFIFO_t TxSlots;			/*! Slots waiting for transmission */
+HENBUSSlot_t *TxSlot;				/*! Transmitted slot (NULL - none) */
+/*! Slot of delivered request (NULL - frame outside window) */
+HENBUSSlot_t *AnsweredSlot;
+/*! Transmitted frame (serialized in transmitted slot) */
+uint8_t *TxFrame;
+#else
+/*! Transmitted frame (serialized) */
+uint8_t TxFrame[HENBUS_FRAME_MAX_LENGTH];
+#endif
+volatile uint8_t TxLength;			/*! Length of transmitted frame */
+volatile uint8_t TxIndex;			/*! Characters queued in serial port */
+volatile bool IsFrameSending;		/*! Frame not sent completely yet */
+/*! Pointer to frame sent callback */
+void (*FrameSentCallback)(void);
 
 /* Function section ----------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 /**
-* @brief    Sends data in ASCII HEX over serial port
-* @param    wdFrame : watchdog frame
+* @brief    Queues rest of staged frame in transmit buffer of serial port
+* @param    None
 * @retval   None
 */
-#ifndef COMM_BINARY_MODE
-static void HENBUSCtrl_SendAsciHexByte(uint8_t data)
+static void HENBUSCtrl_Transmit(void)
 {
-	uint8_t asciiHex[3] = { 0, 0 };
+#if HENBUS_WINDOW_SIZE
+	uint8_t queued;
 	
-	ByteToAsciiHex(asciiHex, data);
-	SerialPort_TransmitChar(SerialPortName, asciiHex[0]);
-	SerialPort_TransmitChar(SerialPortName, asciiHex[1]);
+	// Queued slots one after another (while serial port takes bytes)
+	do
+	{
+		if (TxIndex == TxLength && HENBUSSlotFIFO_Count(&TxSlots))
+		{
+			// Index reset first (no end of transmission in IRQ)
+			TxIndex = 0;
+			HENBUSSlotFIFO_Get(&TxSlots, &TxSlot);
+			TxFrame = TxSlot->Frame;
+			TxLength = TxSlot->Length;
+		}
+		
+		queued = TxIndex < TxLength ?
+			SerialPort_TransmitBlock(SerialPortName, TxFrame + TxIndex,
+			                         TxLength - TxIndex) : 0;
+		TxIndex += queued;
+		
+		// Slot released when whole answer is in serial port
+		if (TxSlot && TxIndex == TxLength)
+		{
+			TxSlot->IsQueued = false;
+			TxSlot = NULL;
+		}
+	} while (queued && TxIndex == TxLength);
+#else
+	if (TxIndex < TxLength)
+	{
+		TxIndex += SerialPort_TransmitBlock(SerialPortName,
+		                                    TxFrame + TxIndex,
+		                                    TxLength - TxIndex);
+	}
+#endif
 }
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Transmission end handler (called from IRQ)
+* @param    serialPortName : serial port name
+* @retval   None
+*/
+static void HENBUSCtrl_TxComplete(ESPName_t serialPortName)
+{
+	(void)serialPortName;
+
+	// Whole frame left (not only queued part, no answer waiting in queue)
+	if (IsFrameSending && TxIndex == TxLength
+#if HENBUS_WINDOW_SIZE
+	    && !HENBUSSlotFIFO_Count(&TxSlots)
 #endif
+	    )
+	{
+		IsFrameSending = false;
+		
+		if (FrameSentCallback)
+		{
+			FrameSentCallback();
+		}
+	}
+}
 
 /*----------------------------------------------------------------------------*/
 /**
-* @brief    Sends frame
-* @param    frame : pointer to the frame
+* @brief    Sets callback of frame transmission end
+* @param    callback : callback called from IRQ (NULL - not used)
 * @retval   None
 */
-static void HENBUSCtrl_SendFrame(CommProtocolFrame_t* frame)
+static void HENBUSCtrl_SetSendCallback(void (*callback)(void))
+{
+	FrameSentCallback = callback;
+	SerialPort_SetTxCompleteCallback(SerialPortName,
+	                                 callback ? HENBUSCtrl_TxComplete : NULL);
+}
+
+#if HENBUS_WINDOW_SIZE
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Calculates FCS of frame header (with window FCS covers address,
+*           sequence header, command and data size)
+* @param    frame : pointer to the frame
+* @param    sequence : sequence header
+* @retval   FCS value before data field
+*/
+static HENBUSFCS_t HENBUSCtrl_HeaderFCS(const CommProtocolFrame_t* frame,
+                                        uint8_t sequence)
 {
+	HENBUSFCS_t crc = HENBUS_FCS_INIT();
+#ifndef COMM_BINARY_MODE
 	uint8_t index;
+#endif
 	
-	if (frame)
-	{
-		// Frame sending
-		
-		// --->SOF - 1 byte
-		SerialPort_TransmitChar(SerialPortName, HENBUS_SOF);
-		
-		// --->Device address
+	crc = HENBUS_FCS_UPDATE(crc, frame->Address);
+	crc = HENBUS_FCS_UPDATE(crc, sequence);
 #ifdef COMM_BINARY_MODE
-		// BINARY mode - 1 byte
-		SerialPort_TransmitChar(SerialPortName, frame->Address);
-#else		
-		// ASCII mode - 2 bytes
-		HENBUSCtrl_SendAsciHexByte(frame->Address);
+	crc = HENBUS_FCS_UPDATE(crc, frame->CommandID);
+#else
+	for (index = 0;
+	     index < HENBUS_ASCII_CMD_SIZE && frame->CommandName[index];
+	     index++)
+	{
+		crc = HENBUS_FCS_UPDATE(crc, frame->CommandName[index]);
+	}
 #endif
-		
-		// --->Command code
-#ifdef COMM_BINARY_MODE
-		// BINARY mode - 1 byte
-		SerialPort_TransmitChar(SerialPortName, frame->CommandID);
+	
+	return HENBUS_FCS_UPDATE(crc, frame->DataSize);
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Serializes frame
+* @param    buffer : frame buffer (HENBUS_FRAME_MAX_LENGTH bytes)
+* @param    frame : pointer to the frame (max. HENBUS_DATA_BUFF_SIZE bytes)
+* @param    sequence : sequence header (window only)
+* @retval   Length of serialized frame
+*/
+static uint8_t HENBUSCtrl_Serialize(uint8_t *buffer,
+                                    const CommProtocolFrame_t* frame
+#if HENBUS_WINDOW_SIZE
+                                    , uint8_t sequence
+#endif
+                                    )
+{
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	// Next character of frame (fields encoded in place later)
+	uint8_t *txChar = buffer + HENBUS_COBS_OVERHEAD;
 #else
-		// ASCII mode - variable bytes
-		SerialPort_TransmitText(SerialPortName, frame->CommandName);
+	uint8_t *txChar = buffer;			// Next character of frame
 #endif
-		
-		// --->Data size
+	uint8_t index;
+#if HENBUS_WINDOW_SIZE
+	HENBUSFCS_t crc = HENBUSCtrl_HeaderFCS(frame, sequence);
+#else
+	HENBUSFCS_t crc = HENBUS_FCS_INIT();
+#endif
+	
+#if HENBUS_FRAMING != HENBUS_FRAMING_COBS
+	// --->SOF - 1 byte
+	*txChar++ = HENBUS_SOF;
+#endif
+	
 #ifdef COMM_BINARY_MODE
-		// BINARY mode - 1 byte
-		SerialPort_TransmitChar(SerialPortName, frame->DataSize);
+	// --->Device address - 1 byte
+	*txChar++ = frame->Address;
+	
+#if HENBUS_WINDOW_SIZE
+	// --->Sequence header - 1 byte
+	*txChar++ = sequence;
+#endif
+	
+	// --->Command code and data size - 1 byte
+	*txChar++ = frame->CommandID;
+	*txChar++ = frame->DataSize;
+	
+	// --->Data field - 1 byte * DataSize
+	memcpy(txChar, frame->Data, frame->DataSize);
+	txChar += frame->DataSize;
 #else
-		// ASCII mode - 2 bytes
-		HENBUSCtrl_SendAsciHexByte(frame->DataSize);
+	// --->Device address - 2 bytes
+	ByteToAsciiHex(txChar, frame->Address);
+	txChar += 2;
+	
+#if HENBUS_WINDOW_SIZE
+	// --->Sequence header - 2 bytes
+	ByteToAsciiHex(txChar, sequence);
+	txChar += 2;
+#endif
+	
+	// --->Command code - variable bytes
+	for (index = 0;
+	     index < HENBUS_ASCII_CMD_SIZE && frame->CommandName[index];
+	     index++)
+	{
+		*txChar++ = frame->CommandName[index];
+	}
+	
+	// --->Data size - 2 bytes
+	ByteToAsciiHex(txChar, frame->DataSize);
+	txChar += 2;
+	
+	// --->Data field - 2 bytes * DataSize
+	BytesToAsciiHex(txChar, frame->Data, frame->DataSize);
+	txChar += frame->DataSize * 2;
+#endif
+	
+#if !HENBUS_WINDOW_SIZE
+	// Frame without data has no CRC (with window CRC covers header)
+	if (frame->DataSize > 0)
 #endif
+	{
+		// --->CRC - HENBUS_FCS_SIZE bytes (high byte first)
+		for (index = 0; index < frame->DataSize; index++)
+		{
+			crc = HENBUS_FCS_UPDATE(crc, frame->Data[index]);
+		}
+		crc = HENBUS_FCS_FINAL(crc);
 		
-		// --->Data field
-		if (frame->DataSize > 0)
+		for (index = HENBUS_FCS_SIZE; index > 0; index--)
 		{
-			// Data sending - frame->DataSize * 2 bytes
-			for (index = 0; index < frame->DataSize; index++)
-			{
 #ifdef COMM_BINARY_MODE
-				// BINARY mode - 1 byte * DataSize
-				SerialPort_TransmitChar(SerialPortName, frame->Data[index]);
+			*txChar++ = (uint8_t)(crc >> ((index - 1) * 8));
 #else
-				// ASCII mode - 2 bytes * DataSize
-				HENBUSCtrl_SendAsciHexByte(frame->Data[index]);
+			ByteToAsciiHex(txChar, (uint8_t)(crc >> ((index - 1) * 8)));
+			txChar += 2;
 #endif
-			}
-			
-			// --->CRC - 2 bytes
-#ifdef COMM_BINARY_MODE
-			// BINARY mode - 1 byte
-			SerialPort_TransmitChar(
-				SerialPortName,
-				CRC8(frame->Data, frame->DataSize));
+		}
+	}
+	
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	// --->COBS encoding and delimiter - 1 byte
+	txChar = buffer + COBS_Encode(buffer, buffer + HENBUS_COBS_OVERHEAD,
+		txChar - buffer - HENBUS_COBS_OVERHEAD);
+	*txChar++ = COBS_DELIMITER;
 #else
-			// ASCII mode - 2 bytes
-			HENBUSCtrl_SendAsciHexByte(CRC8(frame->Data, frame->DataSize));
+	// --->EOF - 1 byte
+	*txChar++ = HENBUS_EOF;
 #endif
-		}
+	
+	return txChar - buffer;
+}
+
+#if HENBUS_WINDOW_SIZE
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Queues answer cached in slot (if not queued yet)
+* @param    slot : slot of window
+* @retval   None
+*/
+static void HENBUSCtrl_QueueSlot(HENBUSSlot_t *slot)
+{
+	if (!slot->IsQueued)
+	{
+		slot->IsQueued = true;
+		HENBUSSlotFIFO_Add(&TxSlots, slot);
+		IsFrameSending = true;
+		HENBUSCtrl_Transmit();
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Serializes answer to slot and queues it
+* @param    slot : slot of window (not queued)
+* @param    frame : answer frame
+* @param    sequence : sequence header of answer
+* @param    state : new state of slot
+* @retval   None
+*/
+static void HENBUSCtrl_Answer(HENBUSSlot_t *slot,
+                              const CommProtocolFrame_t* frame,
+                              uint8_t sequence, EHENBUSSlotState_t state)
+{
+	slot->Length = HENBUSCtrl_Serialize(slot->Frame, frame, sequence);
+	slot->State = state;
+	HENBUSCtrl_QueueSlot(slot);
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Sends frame (serialized to transmit buffer, without waiting)
+* @param    frame : pointer to the frame
+* @retval   Frame accepted flag (false - previous frame not queued yet or
+*           request already answered)
+*/
+static bool HENBUSCtrl_SendFrame(CommProtocolFrame_t* frame)
+{
+	bool isAccepted = false;
+#if HENBUS_WINDOW_SIZE
+	// Answer of delivered request or frame outside window
+	HENBUSSlot_t *slot = AnsweredSlot ? AnsweredSlot :
+		&Slots[HENBUS_WINDOW_SIZE];
+	
+	if (frame && frame->DataSize <= HENBUS_DATA_BUFF_SIZE &&
+	    !slot->IsQueued &&
+	    (!AnsweredSlot || slot->State == HENBUS_SLOT_PENDING))
+	{
+		HENBUSCtrl_Answer(slot, frame, AnsweredSlot ?
+		                  HENBUS_SEQ_DATA | slot->Sequence : HENBUS_SEQ_NONE,
+		                  HENBUS_SLOT_ANSWERED);
+		isAccepted = true;
+	}
+#else
+	if (frame && frame->DataSize <= HENBUS_DATA_BUFF_SIZE &&
+	    TxIndex == TxLength)
+	{
+		TxLength = HENBUSCtrl_Serialize(TxFrame, frame);
 		
-		// --->EOF - 1 byte
-		SerialPort_TransmitChar(SerialPortName, HENBUS_EOF);
+		// One block to serial port (rest queued by handler)
+		TxIndex = 0;
+		IsFrameSending = true;
+		HENBUSCtrl_Transmit();
+		isAccepted = true;
 	}
+#endif
+	
+	return isAccepted;
 }
 
+#if HENBUS_WINDOW_SIZE
 /*----------------------------------------------------------------------------*/
 /**
-* @brief    HENBUScontroller handler
-* @param    None
-* @retval   Connection state (true - connected)
+* @brief    Checks sequence header of received frame (repeated requests
+*           answered from cache, requests with invalid CRC rejected without
+*           change of window, because their header can be damaged)
+* @param    frame : received frame
+* @param    sequence : sequence header
+* @param    isValid : valid CRC flag
+* @retval   Delivery flag (new request or frame outside window)
 */
-static bool HENBUSCtrl_Handler()
+static bool HENBUSCtrl_CheckWindow(CommProtocolFrame_t* frame,
+                                   uint8_t sequence, bool isValid)
 {
-	// Currently received byte
-	uint8_t currentByte = SerialPort_ReceiveChar_Irq(SerialPortName, 0);	
-	static uint8_t byteIdx = 0;		// Bytes index
-#ifndef COMM_BINARY_MODE
-	static uint8_t AsciiHexByte[2];	// Current ASCII HEX byte
-#endif
-	// Beginning and end index of current field
-	static int8_t currentFieldStartIndex = 0, currentFieldEndIndex = 0;
-	// Beginning and end index of data field
-	static uint8_t dataStartIndex = 0, dataEndIndex = 0;
-	// Beginning and end index of CRC field
-	static uint8_t crcStartIndex = 0, crcEndIndex = 0;	
-	static uint8_t crcOfFrame = 0;			// CRC of current frame	
-	static uint16_t timeoutTimer = 1;		// Timeout timer	
-	static bool isConnected = false;		// Flag of connection status
+	HENBUSSlot_t *slot = &Slots[sequence & (HENBUS_WINDOW_SIZE - 1)];
+	uint8_t type = sequence & HENBUS_SEQ_TYPE_MASK;
+	uint8_t number = sequence & HENBUS_SEQ_NUMBER_MASK;
+	CommProtocolFrame_t answer;
+	bool isDelivered = false;
 	
-	if (!--timeoutTimer)
+	if (!isValid)
 	{
-		isConnected = false;
-		timeoutTimer = TimeoutTime;
+		// Header of request in NAK (sent outside window)
+		slot = &Slots[HENBUS_WINDOW_SIZE];
+		if (type == HENBUS_SEQ_DATA && !slot->IsQueued)
+		{
+			answer = *frame;
+			answer.DataSize = 0;
+			HENBUSCtrl_Answer(slot, &answer, HENBUS_SEQ_NAK | number,
+			                  HENBUS_SLOT_ANSWERED);
+		}
 	}
-					
-	// --->Bytes analysis
+	else if (type == HENBUS_SEQ_NONE)
+	{
+		isDelivered = true;
+	}
+	else if (slot->Sequence == number && slot->State == HENBUS_SLOT_ANSWERED)
+	{
+		// Repeated request or NAK of answer (answer lost)
+		if (type != HENBUS_SEQ_ACK)
+		{
+			HENBUSCtrl_QueueSlot(slot);
+		}
+	}
+	else if (type == HENBUS_SEQ_DATA && !slot->IsQueued &&
+	         (slot->Sequence != number || slot->State != HENBUS_SLOT_PENDING))
+	{
+		slot->Sequence = number;
+		slot->State = HENBUS_SLOT_PENDING;
+		isDelivered = true;
+	}
+	
+	return isDelivered;
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Analyses received byte (SOF or COBS delimiter restarts reception in
+*           every state)
+* @param    currentByte : received byte
+* @retval   Complete and valid frame flag (frame added to ready queue)
+*/
+static bool HENBUSCtrl_ReceiveByte(uint8_t currentByte)
+{
+	static EHENBUSRxState_t state = HENBUS_RX_SOF;	// Receiver state
+	static uint8_t charCounter = 0;		// Characters left in current field
+	static uint8_t fieldValue = 0;		// Value of current field (byte)
+	static uint8_t dataIndex = 0;		// Index of current data byte
+	static uint16_t skipCounter = 0;	// Characters left to skip
+	static bool isForeignFrame = false;	// Frame of other node flag
+	static HENBUSFCS_t crcOfFrame = 0;	// CRC of current frame	
+	static HENBUSFCS_t crcOfData = 0;	// CRC of received data
+#if HENBUS_WINDOW_SIZE
+	static uint8_t sequence = 0;		// Sequence header of current frame
+#endif
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	static COBSDecoder_t decoder;		// Decoder of frame
+	int16_t decodedByte = -1;			// Decoded byte (-1 - code byte)
+#endif
+	bool isFrameStart, isFrameEnd;		// Flags of frame boundaries
+	bool isValid;						// Flag of valid CRC
+	bool isFrameReceived = false;		// Flag of complete frame
+	
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	// Delimiter ends frame (with complete last block) and starts next one
+	isFrameStart = currentByte == COBS_DELIMITER;
+	isFrameEnd = isFrameStart && COBS_IsDecoderComplete(&decoder);
+	
+	if (isFrameStart)
+	{
+		COBS_DecoderInit(&decoder);
+	}
+	else
+	{
+		decodedByte = COBS_DecodeByte(&decoder, currentByte);
+		currentByte = (uint8_t)decodedByte;
+	}
+#else
+	isFrameStart = currentByte == HENBUS_SOF;
+	isFrameEnd = currentByte == HENBUS_EOF;
+#endif
 	
-	// Save of frame byte by byte
-	if(currentByte == HENBUS_SOF ||
-	   currentByte == HENBUS_EOF ||
-	   (currentByte >= 0 && byteIdx))
+	// --->End of frame (only after complete frame)
+	if (isFrameEnd && state == HENBUS_RX_EOF)
 	{
-		// SOF detection
-		if (currentByte == HENBUS_SOF)
+		// CRC check (calculated while receiving)
+#if HENBUS_WINDOW_SIZE
+		isValid = HENBUS_FCS_FINAL(crcOfData) == crcOfFrame;
+#else
+		isValid = !ReceivingFrame->DataSize ||
+		          HENBUS_FCS_FINAL(crcOfData) == crcOfFrame;
+#endif
+		
+#if HENBUS_WINDOW_SIZE
+		// Repeated and rejected requests not delivered
+		isValid = HENBUSCtrl_CheckWindow(ReceivingFrame, sequence, isValid);
+		FrameSequences[ReceivingFrame - Frames] = sequence;
+#endif
+		
+		if (isValid)
 		{
-			// Frame receive initialization
-			CurrentFrame.Address = 0;
-			CurrentFrame.DataSize = 0;			
-			byteIdx = HENBUS_SOF_START_INDEX;
+			isFrameReceived = true;
 			
-			// Indexes of Address field
-			currentFieldStartIndex = HENBUS_ADDRESS_START_INDEX;
-			currentFieldEndIndex = HENBUS_ADDRESS_END_INDEX;
+			// Frame handed off, next frame to next free buffer
+			HENBUSFrameFIFO_Add(&ReadyFrames, ReceivingFrame);
+			if (!HENBUSFrameFIFO_Get(&FreeFrames, &ReceivingFrame))
+			{
+				ReceivingFrame = NULL;
+			}
 		}
 		
-		// Completing the frame 
-		if (byteIdx >= currentFieldStartIndex &&
-		    byteIdx <= currentFieldEndIndex)
+		state = HENBUS_RX_SOF;
+	}
+	
+	if (isFrameStart)
+	{
+		// Frame receive initialization
+		crcOfData = HENBUS_FCS_INIT();
+		crcOfFrame = 0;
+		fieldValue = 0;
+		charCounter = HENBUS_ADDRES_LENGTH;
+		state = HENBUS_RX_ADDRESS;
+	}
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	else if (decodedByte >= 0)
+#else
+	else
+#endif
+	{
+		switch (state)
 		{
-			// What is this field?
-								
-			if (// --->Address field
-				currentFieldStartIndex == HENBUS_ADDRESS_START_INDEX ||
-				// --->Data size field
-				currentFieldStartIndex == HENBUS_DATA_SIZE_START_INDEX ||
-				// --->CRC field
-				currentFieldStartIndex == crcStartIndex)
-			{
-#ifndef COMM_BINARY_MODE
-				AsciiHexByte[byteIdx - currentFieldStartIndex] = 
-					currentByte;
-#endif					
-					
-				// Is it last character?
-				if (byteIdx == currentFieldEndIndex)
+			// --->Address field
+			case HENBUS_RX_ADDRESS:
+				fieldValue = HENBUS_CHAR_VALUE(fieldValue, currentByte);
+				
+				if (!--charCounter)
 				{
-					// What field?
-					
-					// --->Address field
-					if  (currentFieldStartIndex == HENBUS_ADDRESS_START_INDEX)
-					{						
-						CurrentFrame.Address =
-#ifndef COMM_BINARY_MODE						
-							AsciiHexToByte(AsciiHexByte);
-#else
-							currentByte;
-#endif
-								
-						// Command field indexes
-						currentFieldStartIndex = HENBUS_CMD_START_INDEX;
-						currentFieldEndIndex = HENBUS_CMD_END_INDEX;
-					} else
-					// --->Field of data size
-					if (currentFieldStartIndex == HENBUS_DATA_SIZE_START_INDEX)
-					{		
-						CurrentFrame.DataSize =
-#ifndef COMM_BINARY_MODE						
-							AsciiHexToByte(AsciiHexByte);
-#else
-							currentByte;
-#endif							
-											
-						// Indexes of data and CRC field					
-						if (CurrentFrame.DataSize)
-						{										
-							currentFieldStartIndex = dataStartIndex =
-								HENBUS_DATA_OR_CRC_START_INDEX;
-							currentFieldEndIndex = dataEndIndex =
-								HENBUS_DATA_OR_CRC_START_INDEX + 
-								CurrentFrame.DataSize
-#ifndef COMM_BINARY_MODE
-								* 2
-#endif								
-								- 1;
-							crcStartIndex = dataEndIndex + 1;
-							crcEndIndex = crcStartIndex + HENBUS_CRC_LENGTH - 1;
-						} 
-						else
-						{
-							// End of transmission if no more bytes in frame 
-							currentFieldStartIndex = currentFieldEndIndex = 0;
-						}
-					} else
-					// --->CRC field
-					if (currentFieldStartIndex == crcStartIndex)
-					{
-						crcOfFrame =
-#ifndef COMM_BINARY_MODE						
-							AsciiHexToByte(AsciiHexByte);
+					ReceivingFrame->Address = fieldValue;
+					isForeignFrame =
+						((fieldValue ^ AddressFilter.Address) &
+						 AddressFilter.Mask) &&
+						!(AddressFilter.IsBroadcastEnabled &&
+						  fieldValue == AddressFilter.BroadcastAddress);
+#if HENBUS_WINDOW_SIZE
+					charCounter = HENBUS_SEQ_LENGTH;
+					state = HENBUS_RX_SEQUENCE;
 #else
-							currentByte;	
-#endif												
-					}
+					charCounter = HENBUS_CMD_LENGTH;
+					state = HENBUS_RX_COMMAND;
+#endif
+				}
+				break;
+				
+#if HENBUS_WINDOW_SIZE
+			// --->Sequence header field
+			case HENBUS_RX_SEQUENCE:
+				fieldValue = HENBUS_CHAR_VALUE(fieldValue, currentByte);
+				
+				if (!--charCounter)
+				{
+					sequence = fieldValue;
+					charCounter = HENBUS_CMD_LENGTH;
+					state = HENBUS_RX_COMMAND;
 				}
-			}			
-			else
+				break;
+#endif
+				
 			// --->Command field
-		    if (currentFieldStartIndex == HENBUS_CMD_START_INDEX)
-			{
-#ifndef COMM_BINARY_MODE				
-				CurrentFrame.CommandName[byteIdx - currentFieldStartIndex] =
+			case HENBUS_RX_COMMAND:
+#ifdef COMM_BINARY_MODE
+				ReceivingFrame->CommandID = currentByte;
+#else
+				ReceivingFrame->CommandName[HENBUS_CMD_LENGTH - charCounter] =
 					currentByte;
-				CurrentFrame.CommandName[byteIdx - currentFieldStartIndex + 1] =
+				ReceivingFrame->CommandName[HENBUS_CMD_LENGTH - charCounter + 1] =
 					0;
-#endif					
-						
-				// Is it last byte of Command field?
-				if (byteIdx == currentFieldEndIndex)
+#endif
+				
+				if (!--charCounter)
 				{
-#ifdef COMM_BINARY_MODE
-					CurrentFrame.CommandID = currentByte;
-#endif					
+					charCounter = HENBUS_DATA_SIZE_LENGTH;
+					state = HENBUS_RX_DATA_SIZE;
+				}
+				break;
+				
+			// --->Data size field
+			case HENBUS_RX_DATA_SIZE:
+				fieldValue = HENBUS_CHAR_VALUE(fieldValue, currentByte);
+				
+				if (!--charCounter)
+				{
+					ReceivingFrame->DataSize = fieldValue;
+					dataIndex = 0;
+					charCounter = HENBUS_CHARS_PER_BYTE;
+#if HENBUS_WINDOW_SIZE
+					crcOfData = HENBUSCtrl_HeaderFCS(ReceivingFrame, sequence);
+#endif
 					
-					// Indexes of data size field
-					currentFieldStartIndex = HENBUS_DATA_SIZE_START_INDEX;
-					currentFieldEndIndex = HENBUS_DATA_SIZE_END_INDEX;
+					if (isForeignFrame)
+					{
+						// Frame boundary tracked without storing and CRC
+#if HENBUS_WINDOW_SIZE
+						skipCounter = ReceivingFrame->DataSize *
+							HENBUS_CHARS_PER_BYTE + HENBUS_CRC_LENGTH;
+#else
+						skipCounter = ReceivingFrame->DataSize ?
+							ReceivingFrame->DataSize * HENBUS_CHARS_PER_BYTE +
+							HENBUS_CRC_LENGTH : 0;
+#endif
+						state = skipCounter ? HENBUS_RX_SKIP : HENBUS_RX_SOF;
+					}
+					else if (!ReceivingFrame->DataSize)
+					{
+#if HENBUS_WINDOW_SIZE
+						// No data field (CRC of header)
+						charCounter = HENBUS_CRC_LENGTH;
+						state = HENBUS_RX_CRC;
+#else
+						// No data and CRC fields
+						state = HENBUS_RX_EOF;
+#endif
+					}
+					else if (ReceivingFrame->DataSize <= HENBUS_DATA_BUFF_SIZE)
+					{
+						state = HENBUS_RX_DATA;
+					}
+					else
+					{
+						// Data do not fit in buffer
+						state = HENBUS_RX_SOF;
+					}
 				}
+				break;
 				
-			}
-			else
 			// --->Data field
-			if (currentFieldStartIndex == dataStartIndex)
-			{
-#ifndef COMM_BINARY_MODE				
-				AsciiHexByte[(byteIdx - currentFieldStartIndex) % 2] =
-					currentByte;
+			case HENBUS_RX_DATA:
+				fieldValue = HENBUS_CHAR_VALUE(fieldValue, currentByte);
+				
+				// Is it complete byte?
+				if (!--charCounter)
+				{
+					ReceivingFrame->Data[dataIndex] = fieldValue;
+					crcOfData = HENBUS_FCS_UPDATE(crcOfData, fieldValue);
+					charCounter = HENBUS_CHARS_PER_BYTE;
 					
-				// Is id complete byte?
-				if ((byteIdx - currentFieldStartIndex) % 2 == 1)
+					// Is it end of data?
+					if (++dataIndex == ReceivingFrame->DataSize)
+					{
+						charCounter = HENBUS_CRC_LENGTH;
+						state = HENBUS_RX_CRC;
+					}
+				}
+				break;
+				
+			// --->CRC field (high byte first)
+			case HENBUS_RX_CRC:
+				crcOfFrame = HENBUS_CHAR_VALUE(crcOfFrame, currentByte);
+				
+				if (!--charCounter)
 				{
-					CurrentFrame.Data[(byteIdx - currentFieldStartIndex) / 2] =
-						AsciiHexToByte(AsciiHexByte);
+					state = HENBUS_RX_EOF;
 				}
-#else
-				CurrentFrame.Data[byteIdx - currentFieldStartIndex] =
-					currentByte;			
-#endif				
+				break;
 				
-				// Is it end of data?
-				if (byteIdx == currentFieldEndIndex)
+			// --->Data and CRC of other node (EOF ignored in SOF state)
+			case HENBUS_RX_SKIP:
+				if (!--skipCounter)
 				{
-					// Indexes of CRC field
-					currentFieldStartIndex = currentFieldEndIndex + 1;
-					currentFieldEndIndex = currentFieldStartIndex + 
-						HENBUS_CRC_LENGTH  - 1;
+					state = HENBUS_RX_SOF;
 				}
-			}
+				break;
+				
+			// --->EOF field (other byte than EOF - invalid frame)
+			case HENBUS_RX_EOF:
+				state = HENBUS_RX_SOF;
+				break;
+				
+			// --->Waiting for SOF
+			default:
+				break;
+		}
+	}
+	
+	return isFrameReceived;
+}
+
+#ifndef COMM_BINARY_MODE
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Calculates slot of command name in hash table
+* @param    name : command name (HENBUS_ASCII_CMD_SIZE characters)
+* @param    seed : multiplier of hash function
+* @retval   Slot index
+*/
+static uint8_t HENBUSCtrl_HashCommand(const uint8_t *name, uint8_t seed)
+{
+	uint16_t hash = 0;
+	uint8_t index;
+	
+	for (index = 0; index < HENBUS_ASCII_CMD_SIZE; index++)
+	{
+		hash = hash * seed + name[index];
+	}
+	
+	return (uint8_t)(hash ^ (hash >> 8)) & (HENBUS_CMD_HASH_SIZE - 1);
+}
+
+/*----------------------------------------------------------------------------*/
+bool HENBUSCtrl_SetCommandTable(const HENBUSCommand_t* commands,
+                                uint8_t commandAmount)
+{
+	uint8_t slots[HENBUS_CMD_HASH_SIZE];
+	uint8_t name[HENBUS_ASCII_CMD_SIZE];
+	uint8_t seed = 0, index, charIndex, slot;
+	bool isCollision = true;
+	
+	if (!commands)
+	{
+		isCollision = false;
+	}
+	else if (commandAmount <= HENBUS_CMD_HASH_SIZE)
+	{
+		// Searching for multiplier without collisions (1 - 255)
+		while (isCollision && ++seed)
+		{
+			memset(slots, 0, sizeof(slots));
+			isCollision = false;
 			
-		}	
+			for (index = 0; index < commandAmount && !isCollision; index++)
+			{
+				for (charIndex = 0; charIndex < HENBUS_ASCII_CMD_SIZE;
+				     charIndex++)
+				{
+					name[charIndex] =
+						pgm_read_byte(&commands[index].Name[charIndex]);
+				}
+				
+				slot = HENBUSCtrl_HashCommand(name, seed);
+				isCollision = slots[slot] != 0;
+				slots[slot] = index + 1;
+			}
+		}
+	}
+	
+	if (!isCollision)
+	{
+		memcpy(CommandSlots, slots, sizeof(CommandSlots));
+		CommandHashSeed = seed;
+		CommandTable = commands;
+	}
+	
+	return !isCollision;
+}
+#else
+/*----------------------------------------------------------------------------*/
+void HENBUSCtrl_SetCommandTable(const HENBUSCommandHandler_t* commandTable)
+{
+	CommandTable = commandTable;
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Sends watchdog answer frame (retried by handler until accepted)
+* @param    None
+* @retval   None
+*/
+static void HENBUSCtrl_SendWatchdogAnswer(void)
+{
+	IsWatchdogPending = !HENBUSCtrl_SendFrame(&WatchdogAnswerFrame)
+#if HENBUS_WINDOW_SIZE
+		// Request in window already answered (its slot is never queued)
+		&& !AnsweredSlot
+#endif
+		;
+}
+
+/*----------------------------------------------------------------------------*/
+void HENBUSCtrl_WatchdogHandler(CommProtocolFrame_t* frame)
+{
+	(void)frame;
+
+	HENBUSCtrl_SendWatchdogAnswer();
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Finds handler of frame command in command table
+* @param    frame : received frame
+* @retval   Command handler (NULL - no handler or no command table)
+*/
+static HENBUSCommandHandler_t HENBUSCtrl_FindHandler(CommProtocolFrame_t* frame)
+{
+	HENBUSCommandHandler_t handler = NULL;
+#ifndef COMM_BINARY_MODE
+	const HENBUSCommand_t *command;
+	uint8_t slot, index;
+#endif
+	
+#ifdef COMM_BINARY_MODE
+	if (CommandTable)
+	{
+		handler = (HENBUSCommandHandler_t)
+			pgm_read_ptr(&CommandTable[frame->CommandID]);
+	}
+#else
+	if (CommandTable &&
+	    (slot = CommandSlots[HENBUSCtrl_HashCommand(frame->CommandName,
+	                                                CommandHashSeed)]))
+	{
+		command = &CommandTable[slot - 1];
+		
+		// Slot holds the only command with this hash
+		for (index = 0;
+		     index < HENBUS_ASCII_CMD_SIZE &&
+		     frame->CommandName[index] == pgm_read_byte(&command->Name[index]);
+		     index++);
+		
+		if (index == HENBUS_ASCII_CMD_SIZE)
+		{
+			handler = (HENBUSCommandHandler_t)pgm_read_ptr(&command->Handler);
+		}
+	}
+#endif
+	
+	return handler;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    Delivers received frames to command handlers or callback (previous
+*           frame is released after callback)
+* @param    None
+* @retval   None
+*/
+static void HENBUSCtrl_DeliverFrames(void)
+{
+	CommProtocolFrame_t *frame;
+	HENBUSCommandHandler_t handler;
+#if HENBUS_WINDOW_SIZE
+	CommProtocolFrame_t answer;
+	uint8_t sequence;
+#endif
+	
+	while (HENBUSFrameFIFO_Get(&ReadyFrames, &frame))
+	{
+#if HENBUS_WINDOW_SIZE
+		// Frames sent during delivery answer the request
+		sequence = FrameSequences[frame - Frames];
+		AnsweredSlot = (sequence & HENBUS_SEQ_TYPE_MASK) == HENBUS_SEQ_DATA ?
+			&Slots[sequence & (HENBUS_WINDOW_SIZE - 1)] : NULL;
+#endif
+		
+		if ((handler = HENBUSCtrl_FindHandler(frame)))
+		{
+			handler(frame);
+		}
+		else
+		{
+			// Do we have complete Watchdog frame (without command table)?
+			if (!CommandTable &&
+#ifndef COMM_BINARY_MODE				
+			    !strcmp((char*)frame->CommandName,
+			            (char*)WatchdogTestFrame.CommandName))
+#else
+			    frame->CommandID == WatchdogTestFrame.CommandID)
+#endif							
+			{
+				HENBUSCtrl_SendWatchdogAnswer();
+			}
 			
-		byteIdx++;
+			if (FrameReceivedCallback)
+			{
+				FrameReceivedCallback(frame);
+			}
+		}
+		
+#if HENBUS_WINDOW_SIZE
+		// Request without answer acknowledged (header of request in ACK)
+		if (AnsweredSlot && AnsweredSlot->State == HENBUS_SLOT_PENDING)
+		{
+			answer = *frame;
+			answer.DataSize = 0;
+			HENBUSCtrl_Answer(AnsweredSlot, &answer,
+			                  HENBUS_SEQ_ACK | AnsweredSlot->Sequence,
+			                  HENBUS_SLOT_ANSWERED);
+		}
+		AnsweredSlot = NULL;
+#endif
 		
-		// Do we have complete frame?
-		if (currentByte == HENBUS_EOF)
+		// Release of previous frame buffer
+		if (DeliveredFrame)
 		{
-			byteIdx = 0;
+			HENBUSFrameFIFO_Add(&FreeFrames, DeliveredFrame);
+			if (!ReceivingFrame)
+			{
+				HENBUSFrameFIFO_Get(&FreeFrames, &ReceivingFrame);
+			}
+		}
+		DeliveredFrame = frame;
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+* @brief    HENBUScontroller handler
+* @param    None
+* @retval   Connection state (true - connected)
+*/
+static bool HENBUSCtrl_Handler()
+{
+	int16_t currentByte;					// Currently received byte
+#if HENBUS_RX_BYTE_BUDGET
+	uint16_t byteCounter = 0;				// Bytes read in this call
+#endif
+	bool isPoolEmpty;						// No free frame buffer flag
+	static uint16_t timeoutTimer = 1;		// Timeout timer	
+	static bool isConnected = false;		// Flag of connection status
+	
+	if (!--timeoutTimer)
+	{
+		isConnected = false;
+		timeoutTimer = TimeoutTime;
+	}
+	
+	do
+	{
+		// Reading of all bytes waiting in receive buffer (or budget)
+		while (ReceivingFrame &&
+#if HENBUS_RX_BYTE_BUDGET
+		       byteCounter < HENBUS_RX_BYTE_BUDGET &&
+#endif
+		       (currentByte = 
+		           SerialPort_ReceiveChar_Irq(SerialPortName, 0)) >= 0)
+		{
+#if HENBUS_RX_BYTE_BUDGET
+			byteCounter++;
+#endif
 			
-			// CRC check
-			if ((CRC8(CurrentFrame.Data, CurrentFrame.DataSize) == crcOfFrame ||
-			    !CurrentFrame.DataSize) &&
-			    FrameReceivedCallback)
+			if (HENBUSCtrl_ReceiveByte((uint8_t)currentByte))
 			{
 				// Timer reset
 				timeoutTimer = TimeoutTime;
 				isConnected = true;
-				
-				// Do we have complete Watchdog frame?
-				if (
-#ifndef COMM_BINARY_MODE				
-					!strcmp((char*)CurrentFrame.CommandName,
-				            (char*)WatchdogTestFrame.CommandName))
-#else
-					CurrentFrame.CommandID == WatchdogTestFrame.CommandID)
-#endif							
-				{
-					HENBUSCtrl_SendFrame(&WatchdogAnswerFrame);
-				}
-				
-				FrameReceivedCallback(&CurrentFrame);				
 			}
 		}
+		
+		// Frames delivered after reading (bytes left if no free buffer)
+		isPoolEmpty = !ReceivingFrame;
+		HENBUSCtrl_DeliverFrames();
+	} while (isPoolEmpty);
+	
+	// Rest of transmitted frame
+	HENBUSCtrl_Transmit();
+	
+	// Watchdog answer rejected while previous frame was queued
+	if (IsWatchdogPending)
+	{
+		HENBUSCtrl_SendWatchdogAnswer();
 	}
 	
 	return isConnected;
@@ -372,17 +1074,69 @@ static bool HENBUSCtrl_Handler()
 CommController_t HENBUSCtrl_Init(const CommProtocolFrame_t* wdTestFrame,
                                  const CommProtocolFrame_t* wdAnswerFrame,
 					             ESPName_t serialPortName,
+                                 const HENBUSAddressFilter_t* addressFilter,
 				                 void (*frameCallback)(CommProtocolFrame_t*),
 								 uint16_t taskInterval) 
 {
+	uint8_t index;
+	
 	WatchdogTestFrame = *wdTestFrame;
 	WatchdogAnswerFrame = *wdAnswerFrame;
+	IsWatchdogPending = false;
 	SerialPortName = serialPortName;
 	TimeoutTime = HENBUS_TIMEOUT / taskInterval;
 	Controller.SendFrame = HENBUSCtrl_SendFrame;
 	Controller.Handler = HENBUSCtrl_Handler;
+	Controller.SetSendCallback = HENBUSCtrl_SetSendCallback;
 	FrameReceivedCallback = frameCallback;
 	
+	CommandTable = NULL;
+	
+	// Address filter (every address by default)
+	if (addressFilter)
+	{
+		AddressFilter = *addressFilter;
+	}
+	else
+	{
+		AddressFilter.Mask = 0;
+		AddressFilter.IsBroadcastEnabled = false;
+	}
+	
+	// Frame pool
+	HENBUSFrameFIFO_Init(&FreeFrames);
+	HENBUSFrameFIFO_Init(&ReadyFrames);
+	for (index = 0; index < HENBUS_FRAME_POOL_SIZE; index++)
+	{
+#ifndef COMM_BINARY_MODE
+		Frames[index].CommandName = Commands[index];
+#endif
+		Frames[index].Data = DataBuffers[index];
+		HENBUSFrameFIFO_Add(&FreeFrames, &Frames[index]);
+	}
+	HENBUSFrameFIFO_Get(&FreeFrames, &ReceivingFrame);
+	DeliveredFrame = NULL;
+	
+#if HENBUS_FRAMING == HENBUS_FRAMING_COBS
+	// Idle line before first frame (no delimiter before it)
+	HENBUSCtrl_ReceiveByte(COBS_DELIMITER);
+#endif
+	
+	// Transmitter
+	TxLength = TxIndex = 0;
+	IsFrameSending = false;
+#if HENBUS_WINDOW_SIZE
+	for (index = 0; index <= HENBUS_WINDOW_SIZE; index++)
+	{
+		Slots[index].State = HENBUS_SLOT_FREE;
+		Slots[index].IsQueued = false;
+	}
+	HENBUSSlotFIFO_Init(&TxSlots);
+	TxSlot = AnsweredSlot = NULL;
+	TxFrame = Slots[0].Frame;
+#endif
+	HENBUSCtrl_SetSendCallback(NULL);
+	
 	return Controller;
 }
 
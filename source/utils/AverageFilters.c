@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <math.h>
+#include <string.h>
 
 // --->User files
 
@@ -54,4 +55,136 @@ uint16_t AverageFilter2(uint16_t currentSample, AvgFilter2_t *filter)
 	return filter->PreviousSum  >> AVG_FILTER_SCALE;					   
 }
 
+/*----------------------------------------------------------------------------*/
+void AverageFilter3_Init(AvgFilter3_t *filter, int16_t *buffer, uint8_t scale)
+{
+	filter->Index = 0;
+	filter->Scale = scale;
+	filter->PreviousSum = 0;
+	filter->Buffer = buffer;
+	memset(buffer, 0, sizeof(int16_t) << scale);
+}
+
+/*----------------------------------------------------------------------------*/
+uint16_t AverageFilter3(uint16_t currentSample, AvgFilter3_t *filter)
+{
+	return AverageFilter3_Scaled(currentSample, filter, filter->Scale);
+}
+
+/*----------------------------------------------------------------------------*/
+void AverageFilter1Bank_Init(AvgFilter1Bank_t *bank,
+                             int32_t *previousSamples,
+                             uint8_t channelAmount,
+                             uint8_t timeConstant)
+{
+	bank->ChannelAmount = channelAmount;
+	bank->TimeConstant = timeConstant;
+	bank->PreviousSamples = previousSamples;
+	memset(previousSamples, 0, sizeof(int32_t) * channelAmount);
+}
+
+/*----------------------------------------------------------------------------*/
+void AverageFilter1Bank(const volatile uint16_t *samples,
+                        int32_t *results,
+                        AvgFilter1Bank_t *bank)
+{
+	const uint8_t timeConstant = bank->TimeConstant;
+	int32_t *previousSample = bank->PreviousSamples;
+	int32_t currentSample;
+	uint8_t channel;
+
+	for (channel = bank->ChannelAmount; channel; channel--)
+	{
+		currentSample = *samples++;
+		*results++ = (((currentSample << AVGF1_SF) >> timeConstant) +
+		              (*previousSample << AVGF1_SF) -
+		             ((*previousSample << AVGF1_SF) >> timeConstant)) >>
+		             AVGF1_SF;
+		*previousSample++ = currentSample;
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+void AverageFilterBank_Init(AvgFilterBank_t *bank,
+                            int32_t *sums,
+                            int16_t *buffer,
+                            uint8_t channelAmount,
+                            uint8_t scale)
+{
+	bank->ChannelAmount = channelAmount;
+	bank->Index = 0;
+	bank->Scale = scale;
+	bank->Sums = sums;
+	bank->Buffer = buffer;
+	memset(sums, 0, sizeof(int32_t) * channelAmount);
+	memset(buffer, 0, (sizeof(int16_t) << scale) * channelAmount);
+}
+
+/*----------------------------------------------------------------------------*/
+void AverageFilterBank(const volatile uint16_t *samples,
+                       uint16_t *results,
+                       AvgFilterBank_t *bank)
+{
+	AverageFilterBank_Scaled(samples, results, bank, bank->Scale);
+}
+
+/*----------------------------------------------------------------------------*/
+void MedianFilter_Init(MedianFilter_t *filter, int16_t initialValue)
+{
+	uint8_t index;
+
+	filter->Index = 0;
+	for (index = 0; index < filter->Size; index++)
+	{
+		filter->History[index] = initialValue;
+		filter->Sorted[index] = initialValue;
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+int16_t MedianFilter(int16_t currentSample, MedianFilter_t *filter)
+{
+	int16_t *sorted = filter->Sorted;
+	int16_t oldestSample = filter->History[filter->Index];
+	uint8_t low = 0, high = filter->Size - 1, position;
+
+	// Replacing the oldest sample in history
+	filter->History[filter->Index] = currentSample;
+	if (++filter->Index == filter->Size)
+	{
+		filter->Index = 0;
+	}
+
+	// Position of the oldest sample in sorted window (binary search)
+	while (low < high)
+	{
+		position = (low + high) >> 1;
+
+		if (sorted[position] < oldestSample)
+		{
+			low = position + 1;
+		}
+		else
+		{
+			high = position;
+		}
+	}
+	position = low;
+
+	// Moving the neighbours into the gap until the new sample fits
+	while (position < filter->Size - 1 && sorted[position + 1] < currentSample)
+	{
+		sorted[position] = sorted[position + 1];
+		position++;
+	}
+	while (position > 0 && sorted[position - 1] > currentSample)
+	{
+		sorted[position] = sorted[position - 1];
+		position--;
+	}
+	sorted[position] = currentSample;
+
+	return sorted[filter->Size >> 1];
+}
+
 /******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,207 @@
+/**
+ *******************************************************************************
+ * @file     BiquadFilter.c
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Fixed-point biquad IIR filters
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+#include <avr/pgmspace.h>
+
+// --->User files
+
+#include "BiquadFilter.h"
+
+/* Function section ----------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Adds 32-bit values with saturation
+ * @param    a : first value
+ * @param    b : second value
+ * @retval   Sum limited to INT32_MIN - INT32_MAX
+ */
+static inline int32_t Biquad_AddSat32(int32_t a, int32_t b)
+{
+	int32_t sum = (int32_t)((uint32_t)a + (uint32_t)b);
+
+	// Overflow if both values have the same sign different from the sum
+	if (((a ^ sum) & (b ^ sum)) < 0)
+	{
+		sum = a < 0 ? INT32_MIN : INT32_MAX;
+	}
+
+	return sum;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Adds 64-bit values with saturation
+ * @param    a : first value
+ * @param    b : second value
+ * @retval   Sum limited to INT64_MIN - INT64_MAX
+ */
+static inline int64_t Biquad_AddSat64(int64_t a, int64_t b)
+{
+	int64_t sum = (int64_t)((uint64_t)a + (uint64_t)b);
+
+	// Overflow if both values have the same sign different from the sum
+	if (((a ^ sum) & (b ^ sum)) < 0)
+	{
+		sum = a < 0 ? INT64_MIN : INT64_MAX;
+	}
+
+	return sum;
+}
+
+/*----------------------------------------------------------------------------*/
+void BiquadQ15_Init(BiquadQ15_t *filter,
+                    const BiquadQ15Coeffs_t *coeffs,
+                    BiquadQ15State_t *states,
+                    uint8_t sectionAmount)
+{
+	filter->Coeffs = coeffs;
+	filter->States = states;
+	filter->SectionAmount = sectionAmount;
+
+	BiquadQ15_Reset(filter);
+}
+
+/*----------------------------------------------------------------------------*/
+void BiquadQ15_Reset(BiquadQ15_t *filter)
+{
+	uint8_t section;
+
+	for (section = 0; section < filter->SectionAmount; section++)
+	{
+		filter->States[section].S1 = 0;
+		filter->States[section].S2 = 0;
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+int16_t BiquadQ15(int16_t currentSample, BiquadQ15_t *filter)
+{
+	const BiquadQ15Coeffs_t *coeffs = filter->Coeffs;
+	BiquadQ15State_t *state = filter->States;
+	int16_t input = currentSample;
+	int16_t output;
+	int32_t accumulator;
+	uint8_t section;
+
+	for (section = 0; section < filter->SectionAmount; section++)
+	{
+		accumulator = Biquad_AddSat32(
+			(int32_t)(int16_t)pgm_read_word(&coeffs->B0) * input +
+			(1L << (BIQUAD_Q15_COEFF_SHIFT - 1)), state->S1);
+		accumulator >>= BIQUAD_Q15_COEFF_SHIFT;
+
+		if (accumulator > INT16_MAX)
+		{
+			output = INT16_MAX;
+		}
+		else if (accumulator < INT16_MIN)
+		{
+			output = INT16_MIN;
+		}
+		else
+		{
+			output = (int16_t)accumulator;
+		}
+
+		// 16 x 16 bit products only, difference of two products always
+		// fits in 32 bits, sum with the other state is saturated
+		state->S1 = Biquad_AddSat32(
+			(int32_t)(int16_t)pgm_read_word(&coeffs->B1) * input -
+			(int32_t)(int16_t)pgm_read_word(&coeffs->A1) * output, state->S2);
+		state->S2 = (int32_t)(int16_t)pgm_read_word(&coeffs->B2) * input -
+		            (int32_t)(int16_t)pgm_read_word(&coeffs->A2) * output;
+
+		input = output;
+		coeffs++;
+		state++;
+	}
+
+	return input;
+}
+
+/*----------------------------------------------------------------------------*/
+void BiquadQ31_Init(BiquadQ31_t *filter,
+                    const BiquadQ31Coeffs_t *coeffs,
+                    BiquadQ31State_t *states,
+                    uint8_t sectionAmount)
+{
+	filter->Coeffs = coeffs;
+	filter->States = states;
+	filter->SectionAmount = sectionAmount;
+
+	BiquadQ31_Reset(filter);
+}
+
+/*----------------------------------------------------------------------------*/
+void BiquadQ31_Reset(BiquadQ31_t *filter)
+{
+	uint8_t section;
+
+	for (section = 0; section < filter->SectionAmount; section++)
+	{
+		filter->States[section].S1 = 0;
+		filter->States[section].S2 = 0;
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+int32_t BiquadQ31(int32_t currentSample, BiquadQ31_t *filter)
+{
+	const BiquadQ31Coeffs_t *coeffs = filter->Coeffs;
+	BiquadQ31State_t *state = filter->States;
+	int32_t input = currentSample;
+	int32_t output;
+	int64_t accumulator;
+	uint8_t section;
+
+	for (section = 0; section < filter->SectionAmount; section++)
+	{
+		accumulator = Biquad_AddSat64(
+			(int64_t)(int32_t)pgm_read_dword(&coeffs->B0) * input +
+			(1LL << (BIQUAD_Q31_COEFF_SHIFT - 1)), state->S1);
+		accumulator >>= BIQUAD_Q31_COEFF_SHIFT;
+
+		if (accumulator > INT32_MAX)
+		{
+			output = INT32_MAX;
+		}
+		else if (accumulator < INT32_MIN)
+		{
+			output = INT32_MIN;
+		}
+		else
+		{
+			output = (int32_t)accumulator;
+		}
+
+		state->S1 = Biquad_AddSat64(
+			(int64_t)(int32_t)pgm_read_dword(&coeffs->B1) * input -
+			(int64_t)(int32_t)pgm_read_dword(&coeffs->A1) * output, state->S2);
+		state->S2 = (int64_t)(int32_t)pgm_read_dword(&coeffs->B2) * input -
+		            (int64_t)(int32_t)pgm_read_dword(&coeffs->A2) * output;
+
+		input = output;
+		coeffs++;
+		state++;
+	}
+
+	return input;
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
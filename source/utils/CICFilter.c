@@ -0,0 +1,103 @@
+/**
+ *******************************************************************************
+ * @file     CICFilter.c
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    CIC decimation filter
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// --->User files
+
+#include "CICFilter.h"
+
+/* Function section ----------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+bool CICFilter_Init(CICFilter_t *filter,
+                    uint8_t order,
+                    uint8_t rate,
+                    uint8_t shift)
+{
+	bool isValid = true;
+	uint8_t rateBits = 0;
+	uint8_t stage;
+
+	if (!rate)
+	{
+		rate = 1;
+		isValid = false;
+	}
+
+	// Bit growth of one stage (ceil(log2(rate)))
+	while ((1u << rateBits) < rate)
+	{
+		rateBits++;
+	}
+
+	// Reducing order until output fits in registers
+	while (order > 1 && (order > CIC_MAX_ORDER ||
+	       CIC_INPUT_BITS + order * rateBits > CIC_REGISTER_BITS))
+	{
+		order--;
+		isValid = false;
+	}
+
+	filter->Order = order;
+	filter->Rate = rate;
+	filter->Shift = shift;
+	filter->Phase = 0;
+
+	for (stage = 0; stage < CIC_MAX_ORDER; stage++)
+	{
+		filter->Integrators[stage] = 0;
+		filter->Delays[stage] = 0;
+	}
+
+	return isValid;
+}
+
+/*----------------------------------------------------------------------------*/
+bool CICFilter(uint16_t currentSample, CICFilter_t *filter, uint16_t *result)
+{
+	uint32_t value = currentSample;
+	uint32_t previous;
+	uint8_t stage;
+
+	// Integrators (at input rate)
+	for (stage = 0; stage < filter->Order; stage++)
+	{
+		value += filter->Integrators[stage];
+		filter->Integrators[stage] = value;
+	}
+
+	if (++filter->Phase < filter->Rate)
+	{
+		return false;
+	}
+	filter->Phase = 0;
+
+	// Combs (at output rate)
+	for (stage = 0; stage < filter->Order; stage++)
+	{
+		previous = filter->Delays[stage];
+		filter->Delays[stage] = value;
+		value -= previous;
+	}
+
+	*result = (uint16_t)(value >> filter->Shift);
+
+	return true;
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
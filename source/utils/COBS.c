@@ -0,0 +1,108 @@
+/**
+ *******************************************************************************
+ * @file     COBS.c
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Consistent Overhead Byte Stuffing
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --->User files
+
+#include "COBS.h"
+
+/* Function section ----------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+uint16_t COBS_Encode(uint8_t *result, const uint8_t *data, uint16_t length)
+{
+	uint8_t *code = result;					// Code byte of current block
+	uint8_t *next = result + 1;				// Next encoded byte
+	uint8_t byte;
+
+	*code = 1;
+
+	for (; length; length--)
+	{
+		// Input byte read before output (encoding in place)
+		byte = *data++;
+
+		// Full block (without zero) ended only if data follows
+		if (*code == COBS_MAX_CODE)
+		{
+			code = next++;
+			*code = 1;
+		}
+
+		if (byte)
+		{
+			*next++ = byte;
+			(*code)++;
+		}
+		else
+		{
+			// Zero replaced by new block
+			code = next++;
+			*code = 1;
+		}
+	}
+
+	return next - result;
+}
+
+/*----------------------------------------------------------------------------*/
+uint16_t COBS_Decode(uint8_t *result, const uint8_t *data, uint16_t length)
+{
+	COBSDecoder_t decoder;
+	uint16_t count = 0;
+	int16_t byte;
+
+	COBS_DecoderInit(&decoder);
+
+	for (; length && *data != COBS_DELIMITER; length--)
+	{
+		if ((byte = COBS_DecodeByte(&decoder, *data++)) >= 0)
+		{
+			result[count++] = (uint8_t)byte;
+		}
+	}
+
+	return count;
+}
+
+/*----------------------------------------------------------------------------*/
+int16_t COBS_DecodeByte(COBSDecoder_t *decoder, uint8_t data)
+{
+	int16_t byte = -1;
+
+	if (decoder->Left)
+	{
+		decoder->Left--;
+		byte = data;
+	}
+	else
+	{
+		// Code byte - implicit zero of previous block
+		if (decoder->Code != COBS_MAX_CODE)
+		{
+			byte = 0;
+		}
+
+		decoder->Code = data;
+		decoder->Left = data - 1;
+	}
+
+	return byte;
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
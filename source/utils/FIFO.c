@@ -2,101 +2,284 @@
  *******************************************************************************
  * @file     FIFO.c
  * @author   HENIUS (Paweł Witak)
- * @version  1.01.001
+ * @version  1.1.2
  * @date     19/03/2011
- * @brief    Obsługa kolejki FIFO
+ * @brief    FIFO queue
  *******************************************************************************
  *
  * <h2><center>COPYRIGHT 2011 HENIUS</center></h2>
  */
 
-/* Sekcja include ------------------------------------------------------------*/
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
 
-// Pliki systemowe
-#include <stdio.h>
-#include <avr/pgmspace.h>
-#include <avr/io.h>
 #include <stdint.h>
-#include <avr/iom128.h>
-#include <avr/interrupt.h>
+#include <stdbool.h>
+#include <string.h>
+
+// --->User files
 
-// Pliki użytkownika
 #include "FIFO.h"
 
-/* Sekcja zmiennych ----------------------------------------------------------*/
-volatile uint16_t I2Ctimeout;       /*!< Licznik timeout'u portu I2C */
+/* Macros, constants and definitions section ---------------------------------*/
 
+// --->Macros
+
+#ifdef FIFO_STATS_ENABLED
+/*! Updates statistics after adding items */
+#define FIFO_STATS_ADDED(fifo, count) \
+{ \
+	(fifo)->Stats.AddedCount += (count); \
+	if ((fifo)->Count > (fifo)->Stats.PeakCount) \
+	{ \
+		(fifo)->Stats.PeakCount = (fifo)->Count; \
+	} \
+}
+/*! Updates statistics after dropping items */
+#define FIFO_STATS_DROPPED(fifo, count) \
+	((fifo)->Stats.DroppedCount += (count))
+#else
+#define FIFO_STATS_ADDED(fifo, count)
+#define FIFO_STATS_DROPPED(fifo, count)
+#endif
 
-/* Sekcja funkcji ------------------------------------------------------------*/
+/* Variable section ----------------------------------------------------------*/
+
+volatile uint16_t I2Ctimeout;				/*!< Timeout counter of I2C port */
+
+/* Function section ----------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 /**
- * @brief    Inicjalizacja kolejki FIFO
- * @param    *fifo : wskaźnik do konfiguracji kolejki
- * @param    *buffer : wskaźnik do bufora kolejki
- * @param    size : rozmiar kolejki
- * @retval   Brak
+ * @brief    Gets the greatest power of 2 which fits into buffer
+ * @param    size : size of buffer
+ * @retval   Capacity of queue
  */
+static uint8_t FIFO_GetCapacity(uint8_t size)
+{
+	uint8_t capacity = FIFO_MAX_SIZE;
+
+	while (capacity > size)
+	{
+		capacity >>= 1;
+	}
+
+	return capacity;
+}
+
+/*----------------------------------------------------------------------------*/
 void FIFO_Init(FIFO_t *fifo, uint8_t *buffer, uint8_t size)
 {
-	fifo->Buffer = buffer;				// Inicjalizacja bufora kolejki
-	fifo->Size = size;					// Inicjalizacja rozmiaru kolejki
-	fifo->Count = 0;					// Resetowanie liczby elementów kolejki
-	fifo->IsQueueFull = false;			// Resetowanie stanu kolejki
+	uint8_t capacity = FIFO_GetCapacity(size);
+
+	fifo->Buffer = buffer;
+	fifo->Size = capacity;
+	fifo->Mask = capacity - 1;
+	fifo->Head = 0;
+	fifo->Tail = 0;
+	fifo->Count = 0;
+	fifo->IsQueueFull = false;
+	FIFO_ResetStats(fifo);
 }
 
 /*----------------------------------------------------------------------------*/
-/**
- * @brief    Dodawanie elementu do kolejki
- * @param    *fifo : wskaźnik do konfiguracji kolejki
- * @param    byte : dodawany element
- * @retval   Brak
- */
 void FIFO_Add(FIFO_t *fifo, uint8_t byte)
 {
-	// Nastąpi dodanie elementu na koniec kolejki
 	if (fifo->Buffer)
 	{
-		// Czy jest miejsce w kolejce?
+		// Is there free space in queue?
 		if (fifo->Count < fifo->Size)
 		{
-			// Jest miejsce, więc można dodać ten element.
 			fifo->IsQueueFull = false;
-			fifo->Buffer[fifo->Count++] = byte;
+			fifo->Buffer[fifo->Head] = byte;
+			fifo->Head = (fifo->Head + 1) & fifo->Mask;
+			fifo->Count++;
+			FIFO_STATS_ADDED(fifo, 1);
 		}
 		else
 		{
-			fifo->IsQueueFull = true;	// Kolejka jest pełna
+			fifo->IsQueueFull = true;
+			FIFO_STATS_DROPPED(fifo, 1);
 		}
 	}
 }
 
 /*----------------------------------------------------------------------------*/
-/**
- * @brief    Pobieranie elementu z kolejki
- * @param    *fifo : wskaźnik do konfiguracji kolejki
- * @retval : Pobrany element (z początku kolejk)
- */
 uint8_t FIFO_Get(FIFO_t *fifo)
 {
-	uint8_t result = 0;				// Pobrany element
-	uint8_t index = 0;
+	uint8_t result = 0;
 
-	// Nastąpi pobranie elementu z początku kolejki
 	if (fifo->Buffer && fifo->Count)
 	{
 		fifo->Count--;
 		fifo->IsQueueFull = false;
-		result = fifo->Buffer[0];		// Pobranie pierwszego elementu z kolejki
-
-		// Teraz trzeba przeunąć wszystkie elementy
-		for (index = 0; index < fifo->Count; index++)
-		{
-			fifo->Buffer[index] = fifo->Buffer[index + 1];
-		}
+		result = fifo->Buffer[fifo->Tail];
+		fifo->Tail = (fifo->Tail + 1) & fifo->Mask;
 	}
 
 	return result;
 }
 
-/******************* (C) COPYRIGHT 2011 HENIUS *************** KONIEC PLIKU ***/
+/*----------------------------------------------------------------------------*/
+uint8_t FIFO_AddBlock(FIFO_t *fifo, const uint8_t *data, uint8_t length)
+{
+	uint8_t firstPart;
+
+	if (!fifo->Buffer)
+	{
+		return 0;
+	}
+
+	fifo->IsQueueFull = length > fifo->Size - fifo->Count;
+	if (fifo->IsQueueFull)
+	{
+		FIFO_STATS_DROPPED(fifo, length - (fifo->Size - fifo->Count));
+		length = fifo->Size - fifo->Count;
+	}
+
+	// Copying up to the buffer end and the rest from its beginning
+	firstPart = fifo->Size - fifo->Head;
+	if (firstPart > length)
+	{
+		firstPart = length;
+	}
+	memcpy(&fifo->Buffer[fifo->Head], data, firstPart);
+	memcpy(fifo->Buffer, data + firstPart, length - firstPart);
+
+	fifo->Head = (fifo->Head + length) & fifo->Mask;
+	fifo->Count += length;
+	FIFO_STATS_ADDED(fifo, length);
+
+	return length;
+}
+
+/*----------------------------------------------------------------------------*/
+uint8_t FIFO_GetBlock(FIFO_t *fifo, uint8_t *data, uint8_t length)
+{
+	FIFOSpan_t spans[2];
+	uint8_t count = FIFO_PeekSpan(fifo, spans);
+
+	if (length > count)
+	{
+		length = count;
+	}
+	if (spans[0].Length > length)
+	{
+		spans[0].Length = length;
+	}
+	memcpy(data, spans[0].Data, spans[0].Length);
+	memcpy(data + spans[0].Length, spans[1].Data, length - spans[0].Length);
+	FIFO_Consume(fifo, length);
+
+	return length;
+}
+
+/*----------------------------------------------------------------------------*/
+uint8_t FIFO_PeekSpan(FIFO_t *fifo, FIFOSpan_t spans[2])
+{
+	uint8_t count = fifo->Buffer ? fifo->Count : 0;
+
+	spans[0].Data = &fifo->Buffer[fifo->Tail];
+	spans[0].Length = fifo->Size - fifo->Tail;
+	if (spans[0].Length > count)
+	{
+		spans[0].Length = count;
+	}
+	spans[1].Data = fifo->Buffer;
+	spans[1].Length = count - spans[0].Length;
+
+	return count;
+}
+
+/*----------------------------------------------------------------------------*/
+void FIFO_Consume(FIFO_t *fifo, uint8_t length)
+{
+	if (length > fifo->Count)
+	{
+		length = fifo->Count;
+	}
+
+	if (length)
+	{
+		fifo->Tail = (fifo->Tail + length) & fifo->Mask;
+		fifo->Count -= length;
+		fifo->IsQueueFull = false;
+	}
+}
+
+#ifdef FIFO_STATS_ENABLED
+/*----------------------------------------------------------------------------*/
+void FIFO_GetStats(FIFO_t *fifo, FIFOStats_t *stats)
+{
+	*stats = fifo->Stats;
+}
+
+/*----------------------------------------------------------------------------*/
+void FIFO_ResetStats(FIFO_t *fifo)
+{
+	fifo->Stats.PeakCount = fifo->Count;
+	fifo->Stats.AddedCount = 0;
+	fifo->Stats.DroppedCount = 0;
+	fifo->Stats.FullTime = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+void FIFO_StatsTick(FIFO_t *fifo)
+{
+	if (fifo->Count == fifo->Size)
+	{
+		fifo->Stats.FullTime++;
+	}
+}
+#endif
+
+/*----------------------------------------------------------------------------*/
+void SPSCFIFO_Init(SPSCFIFO_t *fifo, uint8_t *buffer, uint8_t size)
+{
+	fifo->Buffer = buffer;
+	fifo->Size = FIFO_GetCapacity(size);
+	fifo->Mask = fifo->Size - 1;
+	fifo->Head = 0;
+	fifo->Tail = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+bool SPSCFIFO_Add(SPSCFIFO_t *fifo, uint8_t byte)
+{
+	uint8_t head = fifo->Head;
+
+	if ((uint8_t)(head - FIFO_LoadAcquire(&fifo->Tail)) >= fifo->Size)
+	{
+		return false;
+	}
+
+	fifo->Buffer[head & fifo->Mask] = byte;
+	FIFO_StoreRelease(&fifo->Head, head + 1);
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------*/
+bool SPSCFIFO_Get(SPSCFIFO_t *fifo, uint8_t *byte)
+{
+	uint8_t tail = fifo->Tail;
+
+	if (FIFO_LoadAcquire(&fifo->Head) == tail)
+	{
+		return false;
+	}
+
+	*byte = fifo->Buffer[tail & fifo->Mask];
+	FIFO_StoreRelease(&fifo->Tail, tail + 1);
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------*/
+uint8_t SPSCFIFO_Count(SPSCFIFO_t *fifo)
+{
+	return FIFO_LoadAcquire(&fifo->Head) - FIFO_LoadAcquire(&fifo->Tail);
+}
+
+/******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
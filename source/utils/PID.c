@@ -2,110 +2,143 @@
  *******************************************************************************
  * @file     PID.c
  * @author   HENIUS (Paweł Witak)
- * @version  1.01.001
+ * @version  1.1.2
  * @date     25-05-2011
- * @brief    Regulatora cyfrowy PID
+ * @brief    Digital PID controller
  *
- * 			 Ten plik został napisany w oparciu o kod Atmela (AVR221).
+ * 			 This file is based on Atmel code (AVR221).
  *******************************************************************************
  *
  * <h2><center>COPYRIGHT 2011 HENIUS</center></h2>
  */
 
-/* Sekcja include ------------------------------------------------------------*/
+/* Include section -----------------------------------------------------------*/
 
-// Pliki systemowe
+// --->System files
+
+#include <stdbool.h>
 #include <stdint.h>
-#include <stdio.h>
 
-// Pliki użytkownika
+// --->User files
+
 #include "PID.h"
 
-/* Sekcja zmiennych ----------------------------------------------------------*/
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Macros
+
+/*! Divides by PID_SCALING_FACTOR with shift (rounding toward zero) */
+#define PID_SCALE_DOWN(value) \
+	(((value) < 0 ? (value) + (PID_SCALING_FACTOR - 1) : (value)) >> \
+	 PID_SCALING_SHIFT)
+
+// --->Types
+
+/*! Compile time check of PID_SCALING_SHIFT */
+typedef char PID_ScalingCheck[
+	(1 << PID_SCALING_SHIFT) == PID_SCALING_FACTOR ? 1 : -1];
 
-/* Sekcja funkcji ------------------------------------------------------------*/
+/* Function section ----------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 /**
- * @brief    Inicjalizacja regulatora PID
- * @param    *pid : wskaźnik do struktury konfiguracyjnej regulatora
- * @retval   Brak
+ * @brief    Adds term to output sum of velocity-form controller with
+ *           saturation (both limited to PID_VELOCITY_MAX_SUM, so their sum
+ *           fits in 32 bits)
+ * @param    sum : output sum (scaled)
+ * @param    term : added term (scaled)
+ * @retval   Saturated sum
  */
-void PID_Init(PID_t *pid)
+static inline int32_t PIDVelocity_Accumulate(int32_t sum, int32_t term)
 {
-	// Wartości początkowe dla regulatora
-	pid->SumError = 0;
-	pid->LastProcessValue = 0;
+	if (term > PID_VELOCITY_MAX_SUM)
+	{
+		term = PID_VELOCITY_MAX_SUM;
+	}
+	else if (term < -PID_VELOCITY_MAX_SUM)
+	{
+		term = -PID_VELOCITY_MAX_SUM;
+	}
 
-	// Limity, aby uniknąć przepełnienia
-	pid->MaxError = MAX_INT / (pid->P_Factor + 1);
-	pid->MaxSumError = MAX_I_TERM / (pid->I_Factor + 1);
+	sum += term;
+	if (sum > PID_VELOCITY_MAX_SUM)
+	{
+		sum = PID_VELOCITY_MAX_SUM;
+	}
+	else if (sum < -PID_VELOCITY_MAX_SUM)
+	{
+		sum = -PID_VELOCITY_MAX_SUM;
+	}
+
+	return sum;
 }
 
 /*----------------------------------------------------------------------------*/
 /**
- * @brief    Funkcja obsługi regulatora
- * @param    setValue : wartość zadana
- * @param	 processValue : wartość zmierzona (procesowa)
- * @param    *pid : wskaźnik do struktury konfiguracyjnej regulatora
- * @retval   Brak
+ * @brief    Calculates output of PID controller
+ * @param    error : current error
+ * @param    derivative : change of process value (previous - current)
+ * @param    *sumError : sum of errors
+ * @param    pFactor : proportional gain
+ * @param    iFactor : integral gain
+ * @param    dFactor : derivative gain
+ * @param    maxError : maximal error
+ * @param    maxSumError : maximal sum of errors
+ * @retval   Controller output
  */
-int16_t PID_Handler(int16_t setValue, int16_t processValue, PID_t *pid)
+static inline int16_t PID_Calculate(int16_t error,
+                                    int16_t derivative,
+                                    int32_t *sumError,
+                                    int16_t pFactor,
+                                    int16_t iFactor,
+                                    int16_t dFactor,
+                                    int16_t maxError,
+                                    int32_t maxSumError)
 {
-	int16_t error;					// Aktualna wartość błędu
-	int16_t p_term;					// Wartość wyjściowa członu proporcjonalnego
-	int16_t d_term;					// Wartość wyjściowa członu różniczkującego
-	int32_t i_term;					// Wartość wyjściowa członu całkującego
-	int32_t temp; 					// Wartość tymczasowa
-	int32_t result;					// Wartość wynikowa (nastawa)
+	int16_t p_term;					// Output of proportional term
+	int16_t d_term;					// Output of derivative term
+	int32_t i_term;					// Output of integral term
+	int32_t temp; 					// Temporary value
+	int32_t result;					// Result (controller output)
 
-	// Obliczanie aktualnej wartości błędu
-	error = setValue - pid->LastProcessValue;
-
-	// Obliczenia wartości członu proporcjonalnego i zapobieganie przepełnieniu
-	if (error > pid->MaxError)
+	// Proportional term with overflow protection
+	if (error > maxError)
 	{
-		// Zabezpieczenie "od góry"
 		p_term = MAX_INT;
 	}
-	else if (error < -pid->MaxError)
+	else if (error < -maxError)
 	{
-		// Zabezpieczenie "od dołu"
 		p_term = -MAX_INT;
 	}
 	else
 	{
-		// Wartość w zakresie
-		p_term = pid->P_Factor * error;
+		p_term = pFactor * error;
 	}
 
-	// Obliczenia wartości członu całkującego i zapobieganie przepełnieniu
-	temp = pid->SumError + error;
-	if (temp > pid->MaxSumError)
+	// Integral term with overflow protection
+	temp = *sumError + error;
+	if (temp > maxSumError)
 	{
-		// Zabezpieczenie "od góry"
 		i_term = MAX_I_TERM;
-		pid->SumError = pid->MaxSumError;
+		*sumError = maxSumError;
 	}
-	else if (temp < -pid->MaxSumError)
+	else if (temp < -maxSumError)
 	{
-		// Zabezpieczenie "od dołu"
 		i_term = -MAX_I_TERM;
-		pid->SumError = -pid->MaxSumError;
+		*sumError = -maxSumError;
 	}
 	else
 	{
-		// Wartość w zakresie
-		pid->SumError = temp;
-		i_term = pid->I_Factor * pid->SumError;
+		*sumError = temp;
+		i_term = iFactor * temp;
 	}
 
-	// Obliczenia wartości członu różniczkującego
-	d_term = pid->D_Factor * (pid->LastProcessValue - processValue);
-	pid->LastProcessValue = processValue;
+	// Derivative term
+	d_term = dFactor * derivative;
 
-	// Przygotowanie wartości nastawy
-	result = (p_term + i_term + d_term) / PID_SCALING_FACTOR;
+	// Controller output (shift instead of 32-bit division)
+	result = p_term + i_term + d_term;
+	result = PID_SCALE_DOWN(result);
 	if (result > MAX_INT)
 	{
 		result = MAX_INT;
@@ -118,4 +151,188 @@ int16_t PID_Handler(int16_t setValue, int16_t processValue, PID_t *pid)
 	return (int16_t)result;
 }
 
-/******************* (C) COPYRIGHT 2011 HENIUS *************** KONIEC PLIKU ***/
+/*----------------------------------------------------------------------------*/
+void PID_Init(PID_t *pid)
+{
+	// Initial values of controller
+	pid->SumError = 0;
+	pid->LastProcessValue = 0;
+
+	// Limits to avoid overflow (divisions done once here)
+	pid->MaxError = MAX_INT / (pid->P_Factor + 1);
+	pid->MaxSumError = MAX_I_TERM / (pid->I_Factor + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+int16_t PID_Handler(int16_t setValue, int16_t processValue, PID_t *pid)
+{
+	int16_t lastProcessValue = pid->LastProcessValue;
+
+	pid->LastProcessValue = processValue;
+
+	return PID_Calculate(setValue - lastProcessValue,
+	                     lastProcessValue - processValue,
+	                     &pid->SumError,
+	                     pid->P_Factor,
+	                     pid->I_Factor,
+	                     pid->D_Factor,
+	                     pid->MaxError,
+	                     pid->MaxSumError);
+}
+
+/*----------------------------------------------------------------------------*/
+bool PID_BankInit(PIDBank_t *bank)
+{
+	uint8_t placed[PID_BANK_MAX_SIZE];
+	uint8_t orderIndex = 0;
+	uint8_t lastOrderIndex;
+	uint8_t loop;
+	uint8_t source;
+
+	if (bank->ControllerAmount > PID_BANK_MAX_SIZE)
+	{
+		return false;
+	}
+
+	for (loop = 0; loop < bank->ControllerAmount; loop++)
+	{
+		bank->SumErrors[loop] = 0;
+		bank->LastProcessValues[loop] = 0;
+		bank->MaxErrors[loop] = MAX_INT / (bank->P_Factors[loop] + 1);
+		bank->MaxSumErrors[loop] = MAX_I_TERM / (bank->I_Factors[loop] + 1);
+		placed[loop] = false;
+
+		if (bank->CascadeSources[loop] > bank->ControllerAmount)
+		{
+			return false;
+		}
+	}
+
+	// Dependency order: loop goes after the loop driving its set value
+	while (orderIndex < bank->ControllerAmount)
+	{
+		lastOrderIndex = orderIndex;
+
+		for (loop = 0; loop < bank->ControllerAmount; loop++)
+		{
+			source = bank->CascadeSources[loop];
+
+			if (!placed[loop] &&
+			    (source == PID_BANK_EXTERNAL || placed[source - 1]))
+			{
+				placed[loop] = true;
+				bank->Order[orderIndex++] = loop;
+			}
+		}
+
+		if (orderIndex == lastOrderIndex)
+		{
+			// Cascade links form a cycle
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*----------------------------------------------------------------------------*/
+void PID_BankHandler(const int16_t *setValues,
+                     const int16_t *processValues,
+                     int16_t *outputs,
+                     PIDBank_t *bank)
+{
+	int16_t lastProcessValue;
+	int16_t setValue;
+	uint8_t orderIndex;
+	uint8_t loop;
+	uint8_t source;
+
+	for (orderIndex = 0; orderIndex < bank->ControllerAmount; orderIndex++)
+	{
+		loop = bank->Order[orderIndex];
+		source = bank->CascadeSources[loop];
+		setValue = source == PID_BANK_EXTERNAL ?
+		           setValues[loop] : outputs[source - 1];
+		lastProcessValue = bank->LastProcessValues[loop];
+		bank->LastProcessValues[loop] = processValues[loop];
+
+		outputs[loop] = PID_Calculate(setValue - lastProcessValue,
+		                              lastProcessValue - processValues[loop],
+		                              &bank->SumErrors[loop],
+		                              bank->P_Factors[loop],
+		                              bank->I_Factors[loop],
+		                              bank->D_Factors[loop],
+		                              bank->MaxErrors[loop],
+		                              bank->MaxSumErrors[loop]);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+void PIDVelocity_Init(PIDVelocity_t *pid,
+                      int16_t setValue,
+                      int16_t processValue,
+                      int16_t output)
+{
+	pid->LastError = setValue - processValue;
+	pid->LastProcessValue = processValue;
+	pid->Derivative = 0;
+	pid->OutputSum = (int32_t)output << PID_SCALING_SHIFT;
+}
+
+/*----------------------------------------------------------------------------*/
+int16_t PIDVelocity_Handler(int16_t setValue,
+                            int16_t processValue,
+                            PIDVelocity_t *pid)
+{
+	int16_t error = setValue - processValue;
+	int32_t derivative;				// Filtered derivative
+	int32_t change;					// Change of filtered derivative
+	int32_t sum;					// Unsaturated output (scaled)
+	int32_t saturated;				// Saturated output (scaled)
+
+	// First-order filter of derivative on measurement
+	change = (((int32_t)pid->LastProcessValue - processValue) <<
+	          PID_SCALING_SHIFT) - pid->Derivative;
+	if (change < 0)
+	{
+		// Rounding toward zero (the same as division)
+		change += (1L << pid->FilterShift) - 1;
+	}
+	change >>= pid->FilterShift;
+	derivative = pid->Derivative + change;
+	if (change > MAX_INT)
+	{
+		change = MAX_INT;
+	}
+	else if (change < -MAX_INT)
+	{
+		change = -MAX_INT;
+	}
+	pid->Derivative = derivative;
+
+	// Increment of output (each term fits in 32 bits, their sum may not)
+	sum = PIDVelocity_Accumulate(pid->OutputSum,
+	      (int32_t)pid->P_Factor * ((int32_t)error - pid->LastError));
+	sum = PIDVelocity_Accumulate(sum, (int32_t)pid->I_Factor * error);
+	sum = PIDVelocity_Accumulate(sum,
+	      PID_SCALE_DOWN((int32_t)pid->D_Factor * (int16_t)change));
+	pid->LastError = error;
+	pid->LastProcessValue = processValue;
+
+	// Back-calculation of saturated output
+	saturated = sum;
+	if (saturated > ((int32_t)pid->MaxOutput << PID_SCALING_SHIFT))
+	{
+		saturated = (int32_t)pid->MaxOutput << PID_SCALING_SHIFT;
+	}
+	else if (saturated < ((int32_t)pid->MinOutput << PID_SCALING_SHIFT))
+	{
+		saturated = (int32_t)pid->MinOutput << PID_SCALING_SHIFT;
+	}
+	pid->OutputSum = sum +
+	                 PID_SCALE_DOWN((int32_t)pid->B_Factor * (saturated - sum));
+
+	return (int16_t)PID_SCALE_DOWN(saturated);
+}
+
+/******************* (C) COPYRIGHT 2011 HENIUS *************** END OF FILE ****/
@@ -14,84 +14,111 @@
 
 // --->System files
 
-#include <stdio.h>
 #include <ctype.h>
+#include <avr/pgmspace.h>
+#if defined(__SSE2__) && !defined(__AVR__)
+#include <emmintrin.h>
+#endif
 
 // --->User files
 
 #include "Utils.h"
+#include "CRC8.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Encode table: ASCII HEX digit of half-byte */
+static const uint8_t HexDigits[16] PROGMEM =
+{
+	'0', '1', '2', '3', '4', '5', '6', '7',
+	'8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+/*! Decode table: half-byte of characters '0' - 'f' (0 - not HEX digit) */
+static const uint8_t HexValues['f' - '0' + 1] PROGMEM =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+};
 
 /* Function section ----------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 uint8_t CRC8(uint8_t *dataIn, uint16_t size)
 {
-	#define CRC8INIT  0x00
-	#define CRC8POLY  0x18					//0x18 = X^8+X^5+X^4+X^0
-	
-	uint8_t  crc;
-	uint16_t loopCount;
-	uint8_t  bitCounter;
-	uint8_t  data;
-	uint8_t  feedbackBit;
-	
-	crc = CRC8INIT;
-
-	for (loopCount = 0; loopCount != size; loopCount++)
-	{
-		data = dataIn[loopCount];
-		
-		bitCounter = 8;
-		do 
-		{
-			feedbackBit = (crc ^ data) & 0x01;
-			
-			if ( feedbackBit == 0x01 ) {
-				crc = crc ^ CRC8POLY;
-			}
-			crc = (crc >> 1) & 0x7F;
-			if ( feedbackBit == 0x01 ) {
-				crc = crc | 0x80;
-			}
-			
-			data = data >> 1;
-			bitCounter--;
-			
-		} while (bitCounter > 0);
-	}
-	
-	return crc;
+	return CRC8_Block(CRC8_INIT_VALUE, dataIn, size);
 }
 
 /*----------------------------------------------------------------------------*/
 uint8_t HexToByte(uint8_t hex)
 {
-	uint8_t result = 0;
-	
-	if (hex >= '0' && hex <= '9')
-	{
-		result = hex - '0';
-	} else if (hex >= 'a' && hex <= 'f')
-	{
-		result = hex - 'a' + 0x0A;
-	} else if (hex >= 'A' && hex <= 'F')
-	{
-		result = hex - 'A' + 0x0A;
-	}
+	uint8_t index = hex - '0';
 	
-	return result;
+	return index < sizeof(HexValues) ? pgm_read_byte(&HexValues[index]) : 0;
 }
 
 /*----------------------------------------------------------------------------*/
 uint8_t AsciiHexToByte(uint8_t *asciHex)
 {
-	uint8_t result = 0;
+	return (HexToByte(asciHex[0]) << 4) | HexToByte(asciHex[1]);
+}
+
+/*----------------------------------------------------------------------------*/
+void AsciiHexToBytes(uint8_t *result, const uint8_t *asciiHex, uint16_t length)
+{
+#if defined(__SSE2__) && !defined(__AVR__)
+	const __m128i zero = _mm_set1_epi8('0');
+	const __m128i lowerA = _mm_set1_epi8('a');
+	const __m128i lowerCase = _mm_set1_epi8(0x20);
+	const __m128i minusOne = _mm_set1_epi8(-1);
+	const __m128i ten = _mm_set1_epi8(10);
+	const __m128i six = _mm_set1_epi8(6);
+	const __m128i lowByte = _mm_set1_epi16(0x00FF);
+	__m128i chars, digits, letters, values[2];
+	uint8_t half;
 	
-	result = HexToByte(asciHex[0]);
-	result <<= 4;
-	result |= HexToByte(asciHex[1]);
+	// 16 bytes (32 characters) per iteration
+	for (; length >= 16; length -= 16)
+	{
+		for (half = 0; half < 2; half++)
+		{
+			chars = _mm_loadu_si128((const __m128i *)asciiHex);
+			asciiHex += 16;
+			
+			digits = _mm_sub_epi8(chars, zero);
+			letters = _mm_sub_epi8(_mm_or_si128(chars, lowerCase), lowerA);
+			digits = _mm_and_si128(digits,
+				_mm_and_si128(_mm_cmpgt_epi8(digits, minusOne),
+				              _mm_cmplt_epi8(digits, ten)));
+			letters = _mm_and_si128(_mm_add_epi8(letters, ten),
+				_mm_and_si128(_mm_cmpgt_epi8(letters, minusOne),
+				              _mm_cmplt_epi8(letters, six)));
+			values[half] = _mm_or_si128(digits, letters);
+			
+			// High half-byte (even character) and low (odd character)
+			values[half] = _mm_or_si128(
+				_mm_slli_epi16(_mm_and_si128(values[half], lowByte), 4),
+				_mm_srli_epi16(values[half], 8));
+		}
+		
+		_mm_storeu_si128((__m128i *)result,
+		                 _mm_packus_epi16(values[0], values[1]));
+		result += 16;
+	}
+#endif
 	
-	return result;
+	while (length--)
+	{
+		*result++ = (HexToByte(asciiHex[0]) << 4) | HexToByte(asciiHex[1]);
+		asciiHex += 2;
+	}
 }
 
 /*----------------------------------------------------------------------------*/
@@ -99,22 +126,53 @@ void ByteToAsciiHex(uint8_t *result, uint8_t byte)
 {
 	if (result)
 	{		
-		sprintf((char*)result, "%02X", byte);
+		result[0] = pgm_read_byte(&HexDigits[byte >> 4]);
+		result[1] = pgm_read_byte(&HexDigits[byte & 0x0F]);
+		result[2] = 0;
 	}
 }
 
 /*----------------------------------------------------------------------------*/
-void BytesToAsciiHex(uint8_t* result, uint8_t* bytes, uint8_t length)
+void BytesToAsciiHex(uint8_t* result, uint8_t* bytes, uint16_t length)
 {
-	uint8_t index;
+#if defined(__SSE2__) && !defined(__AVR__)
+	const __m128i halfMask = _mm_set1_epi8(0x0F);
+	const __m128i nine = _mm_set1_epi8(9);
+	const __m128i zero = _mm_set1_epi8('0');
+	const __m128i letterOffset = _mm_set1_epi8('A' - '0' - 10);
+	__m128i data, high, low;
+#endif
 	
 	if (result && bytes)
 	{
-		for (index = 0; index < length; index++)
+#if defined(__SSE2__) && !defined(__AVR__)
+		// 16 bytes (32 characters) per iteration
+		for (; length >= 16; length -= 16)
+		{
+			data = _mm_loadu_si128((const __m128i *)bytes);
+			bytes += 16;
+			
+			high = _mm_and_si128(_mm_srli_epi16(data, 4), halfMask);
+			low = _mm_and_si128(data, halfMask);
+			high = _mm_add_epi8(_mm_add_epi8(high, zero), 
+				_mm_and_si128(_mm_cmpgt_epi8(high, nine), letterOffset));
+			low = _mm_add_epi8(_mm_add_epi8(low, zero), 
+				_mm_and_si128(_mm_cmpgt_epi8(low, nine), letterOffset));
+			
+			_mm_storeu_si128((__m128i *)result, _mm_unpacklo_epi8(high, low));
+			_mm_storeu_si128((__m128i *)(result + 16),
+			                 _mm_unpackhi_epi8(high, low));
+			result += 32;
+		}
+#endif
+		
+		while (length--)
 		{
-			ByteToAsciiHex(result, bytes[index]);
-			result += 2;
+			*result++ = pgm_read_byte(&HexDigits[*bytes >> 4]);
+			*result++ = pgm_read_byte(&HexDigits[*bytes & 0x0F]);
+			bytes++;
 		}
+		*result = 0;
 	}
 }
 
@@ -20,47 +20,20 @@
 // --->User files
 
 #include "OWICrc.h"
+#include "CRC8.h"
 
 /* Function section ----------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------*/
 uint8_t OWI_CRC8(uint8_t inData, uint8_t seed)
 {
-    uint8_t bitsLeft;
-    uint8_t temp;
-
-    for (bitsLeft = 8; bitsLeft > 0; bitsLeft--)
-    {
-        temp = ((seed ^ inData) & 0x01);
-        if (temp == 0)
-        {
-            seed >>= 1;
-        }
-        else
-        {
-            seed ^= 0x18;
-            seed >>= 1;
-            seed |= 0x80;
-        }
-        inData >>= 1;
-    }
-	
-    return seed;    
+	return CRC8_Update(seed, inData);
 }
 
 /*----------------------------------------------------------------------------*/
 uint8_t OWI_CalculateCRC(uint8_t *buff, uint8_t length)
 {
-    uint8_t i;
-    uint8_t crc8 = 0;
-    
-    for (i = 0; i < length; i++)
-    {
-        crc8 = OWI_CRC8(*buff, crc8);
-        buff++;
-    }
-		
-    return crc8;
+	return CRC8_Block(CRC8_INIT_VALUE, buff, length);
 }
 
 /*----------------------------------------------------------------------------*/
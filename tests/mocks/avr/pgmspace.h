@@ -12,4 +12,28 @@
 
 #pragma once
 
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdint.h>
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Macros
+
+#define PROGMEM                                 /*! Program memory attribute */
+
+/*! Reads byte from program memory */
+#define pgm_read_byte(address)  (*(const uint8_t *)(address))
+
+/*! Reads word from program memory */
+#define pgm_read_word(address)  (*(const uint16_t *)(address))
+
+/*! Reads double word from program memory */
+#define pgm_read_dword(address) (*(const uint32_t *)(address))
+
+/*! Reads pointer from program memory */
+#define pgm_read_ptr(address)   (*(void * const *)(address))
+
 /******************* (C) COPYRIGHT 2020 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,76 @@
+/**
+ *******************************************************************************
+ * @file     serial_port_mock.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Mock of file SerialPort.h
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->User files
+
+#include "serial_port_mock.h"
+
+/* Function section ----------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/*! Mock of function SerialPort_ReceiveChar_Irq (timeout is not supported) */
+int16_t SerialPort_ReceiveChar_Irq(ESPName_t serialPortName, uint16_t timeout)
+{
+    deque<uint8_t> &rxBuffer = SerialPort_h_Mock::getInstance().RxBuffer;
+    int16_t data = -1;
+
+    if (!rxBuffer.empty())
+    {
+        data = rxBuffer.front();
+        rxBuffer.pop_front();
+    }
+
+    return data;
+}
+
+/*----------------------------------------------------------------------------*/
+/*! Mock of function SerialPort_TransmitChar */
+void SerialPort_TransmitChar(ESPName_t serialPortName, uint8_t _char)
+{
+    SerialPort_h_Mock::getInstance().TransmitChar(serialPortName, _char);
+}
+
+/*----------------------------------------------------------------------------*/
+/*! Mock of function SerialPort_TransmitText */
+void SerialPort_TransmitText(ESPName_t serialPortName, uint8_t* text)
+{
+    SerialPort_h_Mock::getInstance().TransmitText(serialPortName,
+                                                  (char*)text);
+}
+
+/*----------------------------------------------------------------------------*/
+/*! Mock of function SerialPort_TransmitBlock (queues bytes that fit) */
+uint8_t SerialPort_TransmitBlock(ESPName_t serialPortName,
+                                 const uint8_t *data,
+                                 uint8_t length)
+{
+    SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+    uint8_t count = min<size_t>(length, SP_TX_BUFF_SIZE - 1 -
+                                        serialPort.TxBuffer.size());
+
+    serialPort.TxBuffer.insert(serialPort.TxBuffer.end(), data, data + count);
+    serialPort.TxBlockCounter++;
+
+    return count;
+}
+
+/*----------------------------------------------------------------------------*/
+/*! Mock of function SerialPort_SetTxCompleteCallback */
+void SerialPort_SetTxCompleteCallback(ESPName_t serialPortName,
+                                      SPTxCompleteCallback_t callback)
+{
+    SerialPort_h_Mock::getInstance().TxCompleteCallback = callback;
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
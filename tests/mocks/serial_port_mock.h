@@ -0,0 +1,100 @@
+/**
+ *******************************************************************************
+ * @file     serial_port_mock.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Mock of file SerialPort.h (header file)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#pragma once
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include <gmock/gmock.h>
+
+using namespace std;
+
+// --->User files
+
+#include "base_mock.h"
+#include "SerialPort.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Types
+
+/*! Mock class of file SerialPort.h (buffers emulate IRQ driver) */
+class MOCK_CLASS(SerialPort_h_Mock)
+{
+public:
+    MOCK_METHOD(void, TransmitChar, (ESPName_t, uint8_t));
+    MOCK_METHOD(void, TransmitText, (ESPName_t, string));
+
+    /*! Bytes waiting in receive buffer */
+    deque<uint8_t> RxBuffer;
+    /*! Count of bytes lost because of full receive buffer */
+    uint32_t OverrunCounter = 0;
+    /*! Bytes waiting in transmit buffer */
+    deque<uint8_t> TxBuffer;
+    /*! Bytes sent (left shift register) */
+    vector<uint8_t> SentBytes;
+    /*! Count of blocks queued in transmit buffer */
+    uint32_t TxBlockCounter = 0;
+    /*! Callback of transmission end */
+    SPTxCompleteCallback_t TxCompleteCallback = nullptr;
+
+    /*! Puts byte to receive buffer (like receive IRQ handler) */
+    void ReceiveByte(uint8_t data)
+    {
+        if (RxBuffer.size() < SP_RX_BUFF_SIZE - 1)
+        {
+            RxBuffer.push_back(data);
+        }
+        else
+        {
+            OverrunCounter++;
+        }
+    }
+
+    /*! Sends bytes from transmit buffer (like transmit IRQ handlers) */
+    void SendBytes(size_t count)
+    {
+        bool isSent = false;
+
+        for (; count && !TxBuffer.empty(); count--)
+        {
+            SentBytes.push_back(TxBuffer.front());
+            TxBuffer.pop_front();
+            isSent = true;
+        }
+
+        if (isSent && TxBuffer.empty() && TxCompleteCallback)
+        {
+            TxCompleteCallback(SPN_USART0);
+        }
+    }
+
+    /*! Clears buffers, counters and callback */
+    void Reset()
+    {
+        RxBuffer.clear();
+        OverrunCounter = 0;
+        TxBuffer.clear();
+        SentBytes.clear();
+        TxBlockCounter = 0;
+        TxCompleteCallback = nullptr;
+    }
+};
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,323 @@
+/**
+ *******************************************************************************
+ * @file     henbus_cobs_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file HENBUSController.c (binary mode with COBS framing)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <random>
+#include <string.h>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#define HENBUS_FRAMING			HENBUS_FRAMING_COBS
+/*! The largest data field (encoded frame with delimiter takes 255 bytes) */
+#define HENBUS_DATA_BUFF_SIZE	(249)
+
+// Headers of controller included before namespace (include guards)
+#include <avr/pgmspace.h>
+#include "HENBUSController.h"
+#include "SerialPort.h"
+#include "Utils.h"
+#include "COBS.h"
+#include "CRC8.h"
+#include "CRC16.h"
+#include "CRC32.h"
+#include "TypedFIFO.h"
+
+/*! Controller with COBS framing (another copy of controller in test program) */
+namespace HENBUSCobs
+{
+#include "HENBUSController.c"
+}
+using namespace HENBUSCobs;
+
+#include "base_test.h"
+#include "henbus_test_utils.h"
+#include "serial_port_mock.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Frames received by callback */
+static vector<ReceivedFrame_t> ReceivedFrames;
+
+// --->Test classes
+
+/*! Test class for HENBUS controller tests with COBS framing */
+class TEST_CLASS(HENBUSCobsTest)
+{
+protected:
+	CommProtocolFrame_t WatchdogTest = { 0, 0xFE, 0, nullptr };
+	CommProtocolFrame_t WatchdogAnswer = { 0, 0xFF, 0, nullptr };
+	CommController_t Controller;
+
+	void SetUp() override
+	{
+		SerialPort_h_Mock::getInstance().Reset();
+		ReceivedFrames.clear();
+		Controller = HENBUSCobs::HENBUSCtrl_Init(&WatchdogTest,
+		                                         &WatchdogAnswer, SPN_USART0,
+		                                         nullptr, FrameReceived, 1);
+	}
+
+	static void FrameReceived(CommProtocolFrame_t *frame)
+	{
+		ReceivedFrames.push_back({ frame->Address, frame->CommandID,
+			vector<uint8_t>(frame->Data, frame->Data + frame->DataSize) });
+	}
+
+	/*! Sends frame and returns bytes which left serial port */
+	vector<uint8_t> Send(uint8_t address, const vector<uint8_t> &data)
+	{
+		SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+		CommProtocolFrame_t frame = { address, TestCommand,
+		                              (uint8_t)data.size(),
+		                              (uint8_t*)data.data() };
+		vector<uint8_t> sent;
+
+		EXPECT_TRUE(Controller.SendFrame(&frame));
+		while (!serialPort.TxBuffer.empty())
+		{
+			serialPort.SendBytes(SP_TX_BUFF_SIZE);
+			Controller.Handler();
+		}
+		sent.swap(serialPort.SentBytes);
+
+		return sent;
+	}
+
+	/*! Passes bytes to receive buffer and handles them */
+	void Receive(const vector<uint8_t> &bytes)
+	{
+		SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+
+		for (size_t index = 0; index < bytes.size(); index++)
+		{
+			serialPort.ReceiveByte(bytes[index]);
+			if (index % 64 == 63)
+			{
+				Controller.Handler();
+			}
+		}
+		Controller.Handler();
+	}
+};
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Builds COBS encoded frame with delimiter (independent of
+ *           HENBUSCtrl_Serialize)
+ * @param    address : device address
+ * @param    data : data field
+ * @retval   Frame bytes
+ */
+static vector<uint8_t> BuildCobsFrame(uint8_t address,
+                                      const vector<uint8_t> &data)
+{
+	vector<uint8_t> fields = { address, TestCommand, (uint8_t)data.size() };
+	vector<uint8_t> frame;
+	HENBUSFCS_t crc = HENBUS_FCS_INIT();
+
+	fields.insert(fields.end(), data.begin(), data.end());
+	if (!data.empty())
+	{
+		for (uint8_t byte : data)
+		{
+			crc = HENBUS_FCS_UPDATE(crc, byte);
+		}
+		crc = HENBUS_FCS_FINAL(crc);
+		for (int index = HENBUS_FCS_SIZE; index > 0; index--)
+		{
+			fields.push_back((uint8_t)(crc >> ((index - 1) * 8)));
+		}
+	}
+
+	frame.resize(COBS_MAX_LENGTH(fields.size()));
+	frame.resize(COBS_Encode(frame.data(), fields.data(), fields.size()));
+	frame.push_back(COBS_DELIMITER);
+
+	return frame;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS COBS framing - frames with delimiter, SOF and EOF values in
+ * fields are encoded without zeros and received back
+ */
+UNIT_TEST_F(HENBUSCobsTest_class, HENBUSCobsRoundTripTest)
+{
+	const vector<vector<uint8_t>> payloads = {
+		{},
+		{ 0x00 },
+		{ HENBUS_SOF, HENBUS_EOF, 0x00, 0x00, HENBUS_SOF },
+		{ 0x00, 0xFF, 0x00, HENBUS_EOF, 0x01 },
+		vector<uint8_t>(HENBUS_DATA_BUFF_SIZE, 0x00),
+		vector<uint8_t>(HENBUS_DATA_BUFF_SIZE, HENBUS_EOF)
+	};
+	const uint8_t addresses[] = { 0x00, HENBUS_SOF, HENBUS_EOF, 0x01, 0x00,
+	                              0x7F };
+	vector<uint8_t> link;
+
+	for (size_t index = 0; index < payloads.size(); index++)
+	{
+		vector<uint8_t> sent = Send(addresses[index], payloads[index]);
+
+		EXPECT_EQ(sent, BuildCobsFrame(addresses[index], payloads[index]));
+		EXPECT_EQ(count(sent.begin(), sent.end(), COBS_DELIMITER), 1);
+		EXPECT_LE(sent.size(), (size_t)HENBUS_FRAME_MAX_LENGTH);
+		link.insert(link.end(), sent.begin(), sent.end());
+	}
+
+	Receive(link);
+	ASSERT_EQ(ReceivedFrames.size(), payloads.size());
+	for (size_t index = 0; index < payloads.size(); index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Address, addresses[index]);
+		EXPECT_EQ(ReceivedFrames[index].CommandID, TestCommand);
+		EXPECT_EQ(ReceivedFrames[index].Data, payloads[index]);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS COBS framing - the longest blocks without zero (the largest
+ * own frame and 255 data bytes of other node with full 254-byte block) do not
+ * break next frames
+ */
+UNIT_TEST_F(HENBUSCobsTest_class, HENBUSCobsLongBlockTest)
+{
+	const HENBUSAddressFilter_t filter = { 0x20, 0xF0, false, 0 };
+	vector<uint8_t> longData(HENBUS_DATA_BUFF_SIZE);
+	vector<uint8_t> foreignData(255);
+	vector<uint8_t> sent, link;
+
+	for (size_t index = 0; index < longData.size(); index++)
+	{
+		longData[index] = (uint8_t)(index % 255 + 1);
+	}
+	for (size_t index = 0; index < foreignData.size(); index++)
+	{
+		foreignData[index] = (uint8_t)(255 - index);
+	}
+
+	// Own frame of 253 bytes without zero (one block, code 0xFE)
+	sent = Send(0x21, longData);
+	ASSERT_EQ(sent.size(), (size_t)HENBUS_FRAME_MAX_LENGTH);
+	EXPECT_EQ(sent.front(), 0xFE);
+
+	// Frame of other node with full block (code 0xFF) and 255 data bytes
+	link = BuildCobsFrame(0x31, foreignData);
+	EXPECT_EQ(link.front(), COBS_MAX_CODE);
+	link.insert(link.end(), sent.begin(), sent.end());
+	sent = BuildCobsFrame(0x22, { 0x00, 0x01 });
+	link.insert(link.end(), sent.begin(), sent.end());
+
+	HENBUSCobs::HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer, SPN_USART0,
+	                            &filter, FrameReceived, 1);
+	Receive(link);
+
+	ASSERT_EQ(ReceivedFrames.size(), 2u);
+	EXPECT_EQ(ReceivedFrames[0].Address, 0x21);
+	EXPECT_EQ(ReceivedFrames[0].Data, longData);
+	EXPECT_EQ(ReceivedFrames[1].Address, 0x22);
+	EXPECT_EQ(ReceivedFrames[1].Data, vector<uint8_t>({ 0x00, 0x01 }));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS COBS framing - receiver resynchronizes on delimiter after
+ * garbage and truncated frames
+ */
+UNIT_TEST_F(HENBUSCobsTest_class, HENBUSCobsResyncTest)
+{
+	mt19937 generator(24);
+	uniform_int_distribution<int> byteDistribution(1, 255);
+	uniform_int_distribution<int> sizeDistribution(0, 40);
+	vector<ReceivedFrame_t> expected;
+	vector<uint8_t> link;
+
+	for (int index = 0; index < 200; index++)
+	{
+		vector<uint8_t> data(sizeDistribution(generator));
+		vector<uint8_t> frame;
+		uint8_t address = (uint8_t)index;
+
+		for (uint8_t &byte : data)
+		{
+			byte = (uint8_t)(byteDistribution(generator) & 0x3F);
+		}
+		frame = BuildCobsFrame(address, data);
+
+		switch (index % 4)
+		{
+			// Garbage without delimiter before frame (frame lost)
+			case 0:
+				for (int count = sizeDistribution(generator) + 1; count;
+				     count--)
+				{
+					link.push_back((uint8_t)byteDistribution(generator));
+				}
+				link.insert(link.end(), frame.begin(), frame.end());
+				break;
+
+			// Garbage ended by delimiter before frame
+			case 1:
+				for (int count = sizeDistribution(generator); count; count--)
+				{
+					link.push_back((uint8_t)byteDistribution(generator));
+				}
+				link.push_back(COBS_DELIMITER);
+				link.insert(link.end(), frame.begin(), frame.end());
+				expected.push_back({ address, TestCommand, data });
+				break;
+
+			// Truncated frame (next frame starts at its delimiter)
+			case 2:
+				link.insert(link.end(), frame.begin(),
+				            frame.begin() + frame.size() / 2);
+				link.push_back(COBS_DELIMITER);
+				break;
+
+			// Complete frame
+			default:
+				link.insert(link.end(), frame.begin(), frame.end());
+				expected.push_back({ address, TestCommand, data });
+				break;
+		}
+	}
+
+	Receive(link);
+	EXPECT_EQ(SerialPort_h_Mock::getInstance().OverrunCounter, 0u);
+
+	// Every expected frame received in order (garbage may pass CRC)
+	auto received = ReceivedFrames.begin();
+	for (const ReceivedFrame_t &frame : expected)
+	{
+		received = find(received, ReceivedFrames.end(), frame);
+		ASSERT_NE(received, ReceivedFrames.end());
+		received++;
+	}
+	EXPECT_LE(ReceivedFrames.size(), expected.size() + 2);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
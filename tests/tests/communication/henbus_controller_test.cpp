@@ -0,0 +1,631 @@
+/**
+ *******************************************************************************
+ * @file     henbus_controller_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file HENBUSController.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "HENBUSController.c"
+#include "base_test.h"
+#include "henbus_test_utils.h"
+#include "serial_port_mock.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Baud rate of simulated link [b/s] */
+const uint32_t BaudRate = 115200;
+
+/*! Bits of one character on the line (8N1) */
+const uint32_t CharacterBits = 10;
+
+/*! Interval of protocol handler task [ms] */
+const uint16_t TaskInterval = 1;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Frames received by callback */
+static vector<ReceivedFrame_t> ReceivedFrames;
+
+/*! Bytes received by UART while slow callback is running */
+static vector<uint8_t> SlowCallbackStream;
+
+/*! Index of next byte of SlowCallbackStream */
+static size_t SlowCallbackIndex;
+
+/*! Previously delivered frame (pointer and content) */
+static CommProtocolFrame_t *PreviousFrame;
+static ReceivedFrame_t PreviousContent;
+
+/*! Count of delivered frames overwritten too early */
+static int OverwrittenFrames;
+
+/*! Count of frames delivered in the same buffer as previous frame */
+static int ReusedBuffers;
+
+/*! Count of calls of transmission end callback */
+static int SentCallbacks;
+
+/*! Commands of frames passed to command handler */
+static vector<uint8_t> HandledCommands;
+
+// --->Test classes
+
+/*! Test class for HENBUS controller tests */
+class TEST_CLASS(HENBUSControllerTest)
+{
+protected:
+	CommProtocolFrame_t WatchdogTest = { 0, 0xFE, 0, nullptr };
+	CommProtocolFrame_t WatchdogAnswer = { 0, 0xFF, 0, nullptr };
+	CommController_t Controller;
+
+	void SetUp() override
+	{
+		SerialPort_h_Mock::getInstance().Reset();
+		ReceivedFrames.clear();
+		Controller = HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer,
+		                             SPN_USART0, nullptr, FrameReceived,
+		                             TaskInterval);
+	}
+
+	static void FrameReceived(CommProtocolFrame_t *frame)
+	{
+		ReceivedFrames.push_back({ frame->Address, frame->CommandID,
+			vector<uint8_t>(frame->Data, frame->Data + frame->DataSize) });
+	}
+};
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Frame callback doing nothing (parser benchmark)
+ * @param    frame : received frame
+ * @retval   None
+ */
+static void IgnoreFrame(CommProtocolFrame_t *frame)
+{
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Slow frame callback - checks previous frame and simulates bytes
+ *           received by UART while callback is running
+ * @param    frame : received frame
+ * @retval   None
+ */
+static void SlowFrameReceived(CommProtocolFrame_t *frame)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	ReceivedFrame_t content = { frame->Address, frame->CommandID,
+		vector<uint8_t>(frame->Data, frame->Data + frame->DataSize) };
+
+	if (PreviousFrame)
+	{
+		ReceivedFrame_t previous = { PreviousFrame->Address,
+			PreviousFrame->CommandID,
+			vector<uint8_t>(PreviousFrame->Data,
+			                PreviousFrame->Data + PreviousFrame->DataSize) };
+
+		OverwrittenFrames += !(previous == PreviousContent);
+		ReusedBuffers += PreviousFrame == frame;
+	}
+	PreviousFrame = frame;
+	PreviousContent = content;
+	ReceivedFrames.push_back(content);
+
+	for (int index = 0; index < 20 &&
+	     SlowCallbackIndex < SlowCallbackStream.size(); index++)
+	{
+		serialPort.ReceiveByte(SlowCallbackStream[SlowCallbackIndex++]);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Transmission end callback - counts calls
+ * @param    None
+ * @retval   None
+ */
+static void FrameSent(void)
+{
+	SentCallbacks++;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Command handler - saves command
+ * @param    frame : received frame
+ * @retval   None
+ */
+static void CommandHandled(CommProtocolFrame_t *frame)
+{
+	HandledCommands.push_back(frame->CommandID);
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS handler - one call reads all bytes waiting in receive buffer
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSDrainTest)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	mt19937 generator(0);
+	vector<vector<uint8_t>> sentData(3);
+
+	for (uint8_t index = 0; index < sentData.size(); index++)
+	{
+		for (uint8_t byte : BuildFrame(index + 1, 20, generator,
+		                               sentData[index]))
+		{
+			serialPort.ReceiveByte(byte);
+		}
+	}
+
+	EXPECT_TRUE(Controller.Handler());
+	EXPECT_TRUE(serialPort.RxBuffer.empty());
+	ASSERT_EQ(ReceivedFrames.size(), sentData.size());
+	for (uint8_t index = 0; index < sentData.size(); index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Address, index + 1);
+		EXPECT_EQ(ReceivedFrames[index].CommandID, TestCommand);
+		EXPECT_EQ(ReceivedFrames[index].Data, sentData[index]);
+	}
+
+	EXPECT_TRUE(Controller.Handler());
+	EXPECT_EQ(ReceivedFrames.size(), sentData.size());
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS handler - back-to-back frames at 115200 b/s with handler
+ * called every 1 ms are received without overrun of receive buffer
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSThroughputTest)
+{
+	const int frameAmount = 200;
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	mt19937 generator(1);
+	vector<vector<uint8_t>> sentData(frameAmount);
+	vector<uint8_t> stream;
+	uint32_t bitBudget = 0;
+	size_t streamIndex = 0, maxFill = 0;
+	int ticks = 0;
+
+	for (int index = 0; index < frameAmount; index++)
+	{
+		vector<uint8_t> frame = BuildFrame(1, HENBUS_DATA_BUFF_SIZE / 2,
+		                                   generator, sentData[index]);
+
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+
+	while (streamIndex < stream.size())
+	{
+		// Bytes received by UART during one task interval
+		bitBudget += BaudRate * TaskInterval / 1000;
+		while (bitBudget >= CharacterBits && streamIndex < stream.size())
+		{
+			serialPort.ReceiveByte(stream[streamIndex++]);
+			bitBudget -= CharacterBits;
+		}
+		maxFill = max(maxFill, serialPort.RxBuffer.size());
+
+		Controller.Handler();
+		ticks++;
+	}
+
+	printf("[ BENCH    ] HENBUS %u b/s: %d frames (%zu bytes) in %d ms, "
+	       "max. %zu bytes in RX buffer\n",
+	       BaudRate, frameAmount, stream.size(), ticks, maxFill);
+
+	EXPECT_EQ(serialPort.OverrunCounter, 0u);
+	EXPECT_LT(maxFill, (size_t)SP_RX_BUFF_SIZE / 8);
+	ASSERT_EQ(ReceivedFrames.size(), (size_t)frameAmount);
+	for (int index = 0; index < frameAmount; index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Data, sentData[index]);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS frame pool - slow callback (UART receives next frames in the
+ * meantime) does not corrupt delivered or received frames
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSFramePoolTest)
+{
+	const int frameAmount = 50;
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	mt19937 generator(4);
+	vector<vector<uint8_t>> sentData(frameAmount);
+
+	SlowCallbackStream.clear();
+	SlowCallbackIndex = 0;
+	PreviousFrame = nullptr;
+	OverwrittenFrames = 0;
+	ReusedBuffers = 0;
+	for (int index = 0; index < frameAmount; index++)
+	{
+		vector<uint8_t> frame = BuildFrame(0x40 + index, 10 + index % 20,
+		                                   generator, sentData[index]);
+
+		SlowCallbackStream.insert(SlowCallbackStream.end(), frame.begin(),
+		                          frame.end());
+	}
+	HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer, SPN_USART0, nullptr,
+	                SlowFrameReceived, TaskInterval);
+
+	// Bytes received between handler calls and during callbacks
+	while (SlowCallbackIndex < SlowCallbackStream.size() ||
+	       !serialPort.RxBuffer.empty())
+	{
+		for (int index = 0; index < 100 &&
+		     SlowCallbackIndex < SlowCallbackStream.size(); index++)
+		{
+			serialPort.ReceiveByte(SlowCallbackStream[SlowCallbackIndex++]);
+		}
+		Controller.Handler();
+	}
+
+	EXPECT_EQ(serialPort.OverrunCounter, 0u);
+	EXPECT_EQ(OverwrittenFrames, 0);
+	EXPECT_EQ(ReusedBuffers, 0);
+	ASSERT_EQ(ReceivedFrames.size(), (size_t)frameAmount);
+	for (int index = 0; index < frameAmount; index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Address, 0x40 + index);
+		EXPECT_EQ(ReceivedFrames[index].Data, sentData[index]);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS transmitter - frame queued in one block without waiting,
+ * frame longer than free space is queued by handler, callback is called once
+ * after last byte
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSTransmitTest)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	mt19937 generator(5);
+	vector<vector<uint8_t>> sentData(3);
+	vector<uint8_t> expected;
+	CommProtocolFrame_t frames[3];
+
+	for (int index = 0; index < 3; index++)
+	{
+		vector<uint8_t> frame = BuildFrame(0x10 + index, HENBUS_DATA_BUFF_SIZE,
+		                                   generator, sentData[index]);
+
+		expected.insert(expected.end(), frame.begin(), frame.end());
+		frames[index] = { (uint8_t)(0x10 + index), TestCommand,
+		                  HENBUS_DATA_BUFF_SIZE, sentData[index].data() };
+	}
+	SentCallbacks = 0;
+	Controller.SetSendCallback(FrameSent);
+
+	// First frame in one block, second only partially (transmit buffer full)
+	EXPECT_TRUE(Controller.SendFrame(&frames[0]));
+	EXPECT_EQ(serialPort.TxBlockCounter, 1u);
+	EXPECT_TRUE(Controller.SendFrame(&frames[1]));
+	EXPECT_EQ(serialPort.TxBuffer.size(), SP_TX_BUFF_SIZE - 1u);
+	EXPECT_FALSE(Controller.SendFrame(&frames[2]));
+
+	// Rest of second frame queued by handler
+	while (!serialPort.TxBuffer.empty())
+	{
+		serialPort.SendBytes(30);
+		EXPECT_EQ(SentCallbacks, serialPort.TxBuffer.empty() ? 1 : 0);
+		Controller.Handler();
+	}
+	EXPECT_TRUE(Controller.SendFrame(&frames[2]));
+	serialPort.SendBytes(SP_TX_BUFF_SIZE);
+	EXPECT_EQ(SentCallbacks, 2);
+	EXPECT_EQ(serialPort.SentBytes, expected);
+
+	// Sent frames are received back
+	for (size_t index = 0; index < serialPort.SentBytes.size(); index++)
+	{
+		serialPort.ReceiveByte(serialPort.SentBytes[index]);
+		if (index % 50 == 49)
+		{
+			Controller.Handler();
+		}
+	}
+	Controller.Handler();
+	EXPECT_EQ(serialPort.OverrunCounter, 0u);
+	ASSERT_EQ(ReceivedFrames.size(), 3u);
+	for (int index = 0; index < 3; index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Address, 0x10 + index);
+		EXPECT_EQ(ReceivedFrames[index].Data, sentData[index]);
+	}
+
+	// Too long frame is rejected
+	frames[0].DataSize = HENBUS_DATA_BUFF_SIZE + 1;
+	EXPECT_FALSE(Controller.SendFrame(&frames[0]));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS watchdog - answer frame is sent after watchdog frame
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSWatchdogAnswerTest)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	vector<uint8_t> watchdog = { HENBUS_SOF, 0, 0xFE, 0, HENBUS_EOF };
+	vector<uint8_t> expected = { HENBUS_SOF, 0, 0xFF, 0, HENBUS_EOF };
+
+	for (uint8_t byte : watchdog)
+	{
+		serialPort.ReceiveByte(byte);
+	}
+
+	EXPECT_TRUE(Controller.Handler());
+	EXPECT_EQ(ReceivedFrames.size(), 1u);
+	serialPort.SendBytes(SP_TX_BUFF_SIZE);
+	EXPECT_EQ(serialPort.SentBytes, expected);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS watchdog - answer rejected by busy transmitter is sent by
+ * handler after previous frames
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSWatchdogRetryTest)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	vector<uint8_t> watchdog = { HENBUS_SOF, 0, 0xFE, 0, HENBUS_EOF };
+	vector<uint8_t> answer = { HENBUS_SOF, 0, 0xFF, 0, HENBUS_EOF };
+	mt19937 generator(21);
+	vector<vector<uint8_t>> sentData(2);
+	vector<uint8_t> expected;
+	CommProtocolFrame_t frames[2];
+
+	// Transmitter busy with two long frames
+	for (int index = 0; index < 2; index++)
+	{
+		vector<uint8_t> frame = BuildFrame(0x10 + index, HENBUS_DATA_BUFF_SIZE,
+		                                   generator, sentData[index]);
+
+		expected.insert(expected.end(), frame.begin(), frame.end());
+		frames[index] = { (uint8_t)(0x10 + index), TestCommand,
+		                  HENBUS_DATA_BUFF_SIZE, sentData[index].data() };
+		EXPECT_TRUE(Controller.SendFrame(&frames[index]));
+	}
+	expected.insert(expected.end(), answer.begin(), answer.end());
+
+	for (uint8_t byte : watchdog)
+	{
+		serialPort.ReceiveByte(byte);
+	}
+	EXPECT_TRUE(Controller.Handler());
+	EXPECT_EQ(ReceivedFrames.size(), 1u);
+
+	while (!serialPort.TxBuffer.empty())
+	{
+		serialPort.SendBytes(30);
+		Controller.Handler();
+	}
+	EXPECT_EQ(serialPort.SentBytes, expected);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS command table - frames go directly to command handlers,
+ * frames without handler go to callback, watchdog answered by table entry
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSCommandTableTest)
+{
+	static HENBUSCommandHandler_t commandTable[256];
+	const uint8_t commands[] = { 0x05, 0x06, 0xFE, 0x00, 0xFF, 0x05 };
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	vector<uint8_t> expected = { HENBUS_SOF, 0, 0xFF, 0, HENBUS_EOF };
+
+	commandTable[0x05] = CommandHandled;
+	commandTable[0xFF] = CommandHandled;
+	commandTable[0xFE] = HENBUSCtrl_WatchdogHandler;
+	HandledCommands.clear();
+	HENBUSCtrl_SetCommandTable(commandTable);
+
+	for (uint8_t command : commands)
+	{
+		for (uint8_t byte : { (uint8_t)HENBUS_SOF, (uint8_t)1, command,
+		                      (uint8_t)0, (uint8_t)HENBUS_EOF })
+		{
+			serialPort.ReceiveByte(byte);
+		}
+	}
+	EXPECT_TRUE(Controller.Handler());
+
+	EXPECT_EQ(HandledCommands, vector<uint8_t>({ 0x05, 0xFF, 0x05 }));
+	ASSERT_EQ(ReceivedFrames.size(), 2u);
+	EXPECT_EQ(ReceivedFrames[0].CommandID, 0x06);
+	EXPECT_EQ(ReceivedFrames[1].CommandID, 0x00);
+	serialPort.SendBytes(SP_TX_BUFF_SIZE);
+	EXPECT_EQ(serialPort.SentBytes, expected);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS address filter - only frames of node address (masked) and
+ * broadcast frames are delivered, frames of other nodes do not break next
+ * frames
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSAddressFilterTest)
+{
+	const HENBUSAddressFilter_t filter = { 0x20, 0xF0, true, 0x7F };
+	const uint8_t addresses[] = { 0x20, 0x10, 0x2C, 0x30, 0x7F, 0xA0, 0x21, 0x7E };
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	mt19937 generator(6);
+	vector<ReceivedFrame_t> expected;
+	vector<uint8_t> data;
+
+	Controller = HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer, SPN_USART0,
+	                             &filter, FrameReceived, TaskInterval);
+	for (uint8_t address : addresses)
+	{
+		for (uint8_t dataSize : { 0, 1, 17 })
+		{
+			for (uint8_t byte : BuildFrame(address, dataSize, generator, data))
+			{
+				serialPort.ReceiveByte(byte);
+			}
+			Controller.Handler();
+
+			if ((address & 0xF0) == 0x20 || address == 0x7F)
+			{
+				expected.push_back({ address, TestCommand, data });
+			}
+		}
+	}
+
+	ASSERT_EQ(ReceivedFrames.size(), expected.size());
+	for (size_t index = 0; index < expected.size(); index++)
+	{
+		EXPECT_EQ(ReceivedFrames[index].Address, expected[index].Address);
+		EXPECT_EQ(ReceivedFrames[index].Data, expected[index].Data);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Fuzz test of HENBUS parser (default configuration)
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSParserFuzzTest)
+{
+	CheckParserFuzz(2, ReceivedFrames);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of HENBUS parser against reference parser (host cycles per byte)
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSParserBenchmark)
+{
+	CommProtocolFrame_t referenceFrame = { 0, 0, 0, ReferenceData };
+	vector<uint8_t> stream, data;
+	mt19937 generator(3);
+	uint64_t cycles[2] = { UINT64_MAX, UINT64_MAX };
+	int frames[2];
+
+	while (stream.size() < (1 << 16))
+	{
+		vector<uint8_t> frame = BuildFrame(1, HENBUS_DATA_BUFF_SIZE / 2,
+		                                   generator, data);
+
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+	HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer, SPN_USART0, nullptr,
+	                IgnoreFrame, TaskInterval);
+
+	for (int run = 0; run < 5; run++)
+	{
+		bool isComplete;
+		uint64_t start = ReadCycles();
+
+		frames[0] = 0;
+		for (uint8_t byte : stream)
+		{
+			frames[0] += ReferenceReceiveByte(byte, &referenceFrame, &isComplete);
+		}
+		cycles[0] = min(cycles[0], ReadCycles() - start);
+
+		start = ReadCycles();
+		frames[1] = 0;
+		for (uint8_t byte : stream)
+		{
+			if (HENBUSCtrl_ReceiveByte(byte))
+			{
+				HENBUSCtrl_DeliverFrames();
+				frames[1]++;
+			}
+		}
+		cycles[1] = min(cycles[1], ReadCycles() - start);
+	}
+
+	printf("[ BENCH    ] HENBUS parser: index compare %5.2f, state machine "
+	       "%5.2f cycles per byte\n",
+	       (double)cycles[0] / stream.size(), (double)cycles[1] / stream.size());
+
+	EXPECT_EQ(frames[0], frames[1]);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of HENBUS address filter - traffic of other nodes with and
+ * without filter (host cycles per byte)
+ */
+UNIT_TEST_F(HENBUSControllerTest_class, HENBUSAddressFilterBenchmark)
+{
+	const HENBUSAddressFilter_t filter = { 0x01, 0xFF, false, 0 };
+	vector<uint8_t> stream, data;
+	mt19937 generator(7);
+	uint64_t cycles[2] = { UINT64_MAX, UINT64_MAX };
+	int frames[2];
+
+	while (stream.size() < (1 << 16))
+	{
+		vector<uint8_t> frame = BuildFrame(2, HENBUS_DATA_BUFF_SIZE / 2,
+		                                   generator, data);
+
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+
+	// Runs interleaved (host frequency changes affect both)
+	for (int run = 0; run < 10; run++)
+	{
+		int filterIndex = run % 2;
+		uint64_t start;
+
+		HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer, SPN_USART0,
+		                filterIndex ? &filter : nullptr, IgnoreFrame,
+		                TaskInterval);
+
+		start = ReadCycles();
+		frames[filterIndex] = 0;
+		for (uint8_t byte : stream)
+		{
+			if (HENBUSCtrl_ReceiveByte(byte))
+			{
+				HENBUSCtrl_DeliverFrames();
+				frames[filterIndex]++;
+			}
+		}
+		cycles[filterIndex] = min(cycles[filterIndex], ReadCycles() - start);
+	}
+
+	printf("[ BENCH    ] HENBUS other node traffic: no filter %5.2f, "
+	       "filter %5.2f cycles per byte\n",
+	       (double)cycles[0] / stream.size(), (double)cycles[1] / stream.size());
+
+	EXPECT_GT(frames[0], 0);
+	EXPECT_EQ(frames[1], 0);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,91 @@
+/**
+ *******************************************************************************
+ * @file     henbus_crc16_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file HENBUSController.c (binary mode with CRC16)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <string.h>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#define HENBUS_FCS	HENBUS_FCS_CRC16
+
+// Headers of controller included before namespace (include guards)
+#include <avr/pgmspace.h>
+#include "HENBUSController.h"
+#include "SerialPort.h"
+#include "Utils.h"
+#include "CRC8.h"
+#include "CRC16.h"
+#include "CRC32.h"
+#include "TypedFIFO.h"
+
+/*! Controller with CRC16 (another copy of controller in test program) */
+namespace HENBUSCrc16
+{
+#include "HENBUSController.c"
+}
+using namespace HENBUSCrc16;
+
+#include "base_test.h"
+#include "henbus_test_utils.h"
+#include "serial_port_mock.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Frames received by callback */
+static vector<ReceivedFrame_t> ReceivedFrames;
+
+// --->Test classes
+
+/*! Test class for HENBUS controller tests with CRC16 */
+class TEST_CLASS(HENBUSCrc16Test)
+{
+protected:
+	CommProtocolFrame_t WatchdogTest = { 0, 0xFE, 0, nullptr };
+	CommProtocolFrame_t WatchdogAnswer = { 0, 0xFF, 0, nullptr };
+
+	void SetUp() override
+	{
+		SerialPort_h_Mock::getInstance().Reset();
+		ReceivedFrames.clear();
+		HENBUSCrc16::HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer,
+		                               SPN_USART0, nullptr, FrameReceived, 1);
+	}
+
+	static void FrameReceived(CommProtocolFrame_t *frame)
+	{
+		ReceivedFrames.push_back({ frame->Address, frame->CommandID,
+			vector<uint8_t>(frame->Data, frame->Data + frame->DataSize) });
+	}
+};
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Fuzz test of HENBUS parser with 2 bytes of CRC16
+ */
+UNIT_TEST_F(HENBUSCrc16Test_class, HENBUSCrc16ParserFuzzTest)
+{
+	EXPECT_EQ(HENBUS_FCS_SIZE, 2);
+	CheckParserFuzz(4, ReceivedFrames);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,91 @@
+/**
+ *******************************************************************************
+ * @file     henbus_crc32_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file HENBUSController.c (binary mode with CRC32)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <string.h>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#define HENBUS_FCS	HENBUS_FCS_CRC32
+
+// Headers of controller included before namespace (include guards)
+#include <avr/pgmspace.h>
+#include "HENBUSController.h"
+#include "SerialPort.h"
+#include "Utils.h"
+#include "CRC8.h"
+#include "CRC16.h"
+#include "CRC32.h"
+#include "TypedFIFO.h"
+
+/*! Controller with CRC32 (another copy of controller in test program) */
+namespace HENBUSCrc32
+{
+#include "HENBUSController.c"
+}
+using namespace HENBUSCrc32;
+
+#include "base_test.h"
+#include "henbus_test_utils.h"
+#include "serial_port_mock.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Frames received by callback */
+static vector<ReceivedFrame_t> ReceivedFrames;
+
+// --->Test classes
+
+/*! Test class for HENBUS controller tests with CRC32 */
+class TEST_CLASS(HENBUSCrc32Test)
+{
+protected:
+	CommProtocolFrame_t WatchdogTest = { 0, 0xFE, 0, nullptr };
+	CommProtocolFrame_t WatchdogAnswer = { 0, 0xFF, 0, nullptr };
+
+	void SetUp() override
+	{
+		SerialPort_h_Mock::getInstance().Reset();
+		ReceivedFrames.clear();
+		HENBUSCrc32::HENBUSCtrl_Init(&WatchdogTest, &WatchdogAnswer,
+		                               SPN_USART0, nullptr, FrameReceived, 1);
+	}
+
+	static void FrameReceived(CommProtocolFrame_t *frame)
+	{
+		ReceivedFrames.push_back({ frame->Address, frame->CommandID,
+			vector<uint8_t>(frame->Data, frame->Data + frame->DataSize) });
+	}
+};
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Fuzz test of HENBUS parser with 4 bytes of CRC32
+ */
+UNIT_TEST_F(HENBUSCrc32Test_class, HENBUSCrc32ParserFuzzTest)
+{
+	EXPECT_EQ(HENBUS_FCS_SIZE, 4);
+	CheckParserFuzz(5, ReceivedFrames);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
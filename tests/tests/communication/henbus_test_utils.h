@@ -0,0 +1,324 @@
+/**
+ *******************************************************************************
+ * @file     henbus_test_utils.h
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Helpers of HENBUSController.c tests (header file)
+ *
+ *           Included after HENBUSController.c, so the reference parser and
+ *           frames follow configuration of tested controller.
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+#pragma once
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// --->User files
+
+#include "base_test.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Command of frames sent in tests */
+const uint8_t TestCommand = 0x05;
+
+// --->Types
+
+/*! Frame received by callback */
+typedef struct
+{
+	uint8_t Address;
+	uint8_t CommandID;
+	vector<uint8_t> Data;
+}ReceivedFrame_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Data buffer of reference parser */
+static uint8_t ReferenceData[HENBUS_DATA_BUFF_SIZE];
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Compares received frames
+ * @param    &left : first frame
+ * @param    &right : second frame
+ * @retval   Equality flag
+ */
+static bool operator==(const ReceivedFrame_t &left, const ReceivedFrame_t &right)
+{
+	return left.Address == right.Address &&
+	       left.CommandID == right.CommandID &&
+	       left.Data == right.Data;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference parser - previous HENBUSCtrl_ReceiveByte (binary mode,
+ *           field found by comparing byte index with field indexes)
+ * @param    currentByte : received byte
+ * @param    *frame : received frame
+ * @param    *isComplete : EOF received at expected position flag
+ * @retval   Flag of frame with valid CRC
+ */
+static bool ReferenceReceiveByte(uint8_t currentByte, CommProtocolFrame_t *frame,
+                                 bool *isComplete)
+{
+	static uint8_t byteIdx = 0;
+	static int8_t currentFieldStartIndex = 0, currentFieldEndIndex = 0;
+	static uint8_t dataStartIndex = 0, dataEndIndex = 0;
+	static uint8_t crcStartIndex = 0;
+	static HENBUSFCS_t crcOfFrame = 0;
+	static HENBUSFCS_t crcOfData = 0;
+	bool isFrameReceived = false;
+
+	if (currentByte == HENBUS_SOF || currentByte == HENBUS_EOF || byteIdx)
+	{
+		if (currentByte == HENBUS_SOF)
+		{
+			frame->Address = 0;
+			frame->DataSize = 0;
+			byteIdx = HENBUS_SOF_START_INDEX;
+			crcOfData = HENBUS_FCS_INIT();
+			crcOfFrame = 0;
+			currentFieldStartIndex = HENBUS_ADDRESS_START_INDEX;
+			currentFieldEndIndex = HENBUS_ADDRESS_END_INDEX;
+		}
+
+		if (byteIdx >= currentFieldStartIndex &&
+		    byteIdx <= currentFieldEndIndex)
+		{
+			if (currentFieldStartIndex == HENBUS_ADDRESS_START_INDEX ||
+			    currentFieldStartIndex == HENBUS_DATA_SIZE_START_INDEX)
+			{
+				if (byteIdx == currentFieldEndIndex)
+				{
+					if (currentFieldStartIndex == HENBUS_ADDRESS_START_INDEX)
+					{
+						frame->Address = currentByte;
+						currentFieldStartIndex = HENBUS_CMD_START_INDEX;
+						currentFieldEndIndex = HENBUS_CMD_END_INDEX;
+					}
+					else
+					{
+						frame->DataSize = currentByte;
+						if (frame->DataSize > HENBUS_DATA_BUFF_SIZE)
+						{
+							// Frame dropped (previous parser overflowed
+							// buffer and locked up for data size > 253)
+							byteIdx = 0;
+							return false;
+						}
+						else if (frame->DataSize)
+						{
+							currentFieldStartIndex = dataStartIndex =
+								HENBUS_DATA_OR_CRC_START_INDEX;
+							currentFieldEndIndex = dataEndIndex =
+								HENBUS_DATA_OR_CRC_START_INDEX +
+								frame->DataSize - 1;
+							crcStartIndex = dataEndIndex + 1;
+						}
+						else
+						{
+							currentFieldStartIndex = currentFieldEndIndex = 0;
+						}
+					}
+				}
+			}
+			else if (currentFieldStartIndex == crcStartIndex)
+			{
+				crcOfFrame = ((HENBUSFCS_t)crcOfFrame << 8) | currentByte;
+			}
+			else if (currentFieldStartIndex == HENBUS_CMD_START_INDEX)
+			{
+				if (byteIdx == currentFieldEndIndex)
+				{
+					frame->CommandID = currentByte;
+					currentFieldStartIndex = HENBUS_DATA_SIZE_START_INDEX;
+					currentFieldEndIndex = HENBUS_DATA_SIZE_END_INDEX;
+				}
+			}
+			else if (currentFieldStartIndex == dataStartIndex)
+			{
+				frame->Data[byteIdx - currentFieldStartIndex] = currentByte;
+				crcOfData = HENBUS_FCS_UPDATE(crcOfData, currentByte);
+
+				if (byteIdx == currentFieldEndIndex)
+				{
+					currentFieldStartIndex = currentFieldEndIndex + 1;
+					currentFieldEndIndex = currentFieldStartIndex +
+						HENBUS_CRC_LENGTH - 1;
+				}
+			}
+		}
+
+		byteIdx++;
+
+		if (currentByte == HENBUS_EOF)
+		{
+			*isComplete = byteIdx == HENBUS_DATA_OR_CRC_START_INDEX + 1 +
+				(frame->DataSize ? frame->DataSize + HENBUS_CRC_LENGTH : 0);
+			byteIdx = 0;
+
+			if (HENBUS_FCS_FINAL(crcOfData) == crcOfFrame || !frame->DataSize)
+			{
+				isFrameReceived = true;
+			}
+		}
+	}
+
+	return isFrameReceived;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Builds binary frame with random data (without SOF and EOF
+ *           characters inside)
+ * @param    address : device address
+ * @param    dataSize : count of data bytes
+ * @param    &generator : random generator
+ * @param    &data : generated data
+ * @retval   Frame bytes
+ */
+static vector<uint8_t> BuildFrame(uint8_t address, uint8_t dataSize,
+                                  mt19937 &generator, vector<uint8_t> &data)
+{
+	vector<uint8_t> frame;
+	HENBUSFCS_t crc;
+	bool isValid;
+
+	do
+	{
+		data.resize(dataSize);
+		crc = HENBUS_FCS_INIT();
+		for (uint8_t &byte : data)
+		{
+			do
+			{
+				byte = generator();
+			} while (byte == HENBUS_SOF || byte == HENBUS_EOF);
+			crc = HENBUS_FCS_UPDATE(crc, byte);
+		}
+		crc = HENBUS_FCS_FINAL(crc);
+
+		frame = { HENBUS_SOF, address, TestCommand, dataSize };
+		frame.insert(frame.end(), data.begin(), data.end());
+		for (int index = dataSize ? HENBUS_FCS_SIZE : 0; index > 0; index--)
+		{
+			frame.push_back((uint8_t)(crc >> ((index - 1) * 8)));
+		}
+		frame.push_back(HENBUS_EOF);
+
+		isValid = count(frame.begin() + 1, frame.end() - 1, HENBUS_SOF) == 0 &&
+		          count(frame.begin() + 1, frame.end() - 1, HENBUS_EOF) == 0;
+	} while (!isValid);
+
+	return frame;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Fuzz test of HENBUS parser - on stream of valid and damaged
+ *           frames the same frames as reference parser are received
+ *           (reference frames with EOF at wrong position are skipped)
+ * @param    seed : seed of random generator
+ * @param    &receivedFrames : frames received by controller callback
+ * @retval   None
+ */
+static void CheckParserFuzz(uint32_t seed,
+                            const vector<ReceivedFrame_t> &receivedFrames)
+{
+	CommProtocolFrame_t referenceFrame = { 0, 0, 0, ReferenceData };
+	vector<ReceivedFrame_t> referenceFrames;
+	vector<uint8_t> stream, data;
+	mt19937 generator(seed);
+	int validFrames = 0;
+
+	for (int index = 0; index < 5000; index++)
+	{
+		// Address and size without SOF and EOF characters
+		uint8_t address = generator() % HENBUS_EOF;
+		uint8_t dataSize = generator() % (HENBUS_DATA_BUFF_SIZE + 1);
+		if (dataSize == HENBUS_SOF || dataSize == HENBUS_EOF)
+		{
+			dataSize--;
+		}
+		vector<uint8_t> frame = BuildFrame(address, dataSize, generator, data);
+		uint8_t garbage;
+		size_t position = generator() % frame.size();
+
+		// Damage of frame (no EOF inside frame)
+		do
+		{
+			garbage = generator();
+		} while (garbage == HENBUS_EOF);
+
+		switch (generator() % 8)
+		{
+			case 0:
+				frame[position] = garbage;
+				break;
+			case 1:
+				frame.erase(frame.begin() + position);
+				break;
+			case 2:
+				frame.insert(frame.begin() + position, garbage);
+				break;
+			case 3:
+				frame.resize(position);
+				break;
+			case 4:
+				frame.insert(frame.begin(), generator() % 4, HENBUS_EOF);
+				break;
+			default:
+				validFrames++;
+				break;
+		}
+
+		stream.insert(stream.end(), frame.begin(), frame.end());
+	}
+
+	for (uint8_t byte : stream)
+	{
+		bool isComplete = false;
+
+		if (ReferenceReceiveByte(byte, &referenceFrame, &isComplete) &&
+		    isComplete)
+		{
+			referenceFrames.push_back({ referenceFrame.Address,
+				referenceFrame.CommandID,
+				vector<uint8_t>(referenceFrame.Data,
+				                referenceFrame.Data + referenceFrame.DataSize) });
+		}
+
+		if (HENBUSCtrl_ReceiveByte(byte))
+		{
+			HENBUSCtrl_DeliverFrames();
+		}
+	}
+
+	EXPECT_GE(receivedFrames.size(), (size_t)validFrames);
+	ASSERT_EQ(receivedFrames.size(), referenceFrames.size());
+	EXPECT_TRUE(receivedFrames == referenceFrames);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
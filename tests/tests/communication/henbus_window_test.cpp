@@ -0,0 +1,455 @@
+/**
+ *******************************************************************************
+ * @file     henbus_window_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file HENBUSController.c (sequence header and window)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <string.h>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#define HENBUS_WINDOW_SIZE	(4)
+
+// Headers of controller included before namespace (include guards)
+#include <avr/pgmspace.h>
+#include "HENBUSController.h"
+#include "SerialPort.h"
+#include "Utils.h"
+#include "CRC8.h"
+#include "CRC16.h"
+#include "CRC32.h"
+#include "TypedFIFO.h"
+
+/*! Controller with window (second copy of controller in test program) */
+namespace HENBUSWindow
+{
+#include "HENBUSController.c"
+}
+using namespace HENBUSWindow;
+
+#include "base_test.h"
+#include "serial_port_mock.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Baud rate of simulated link [b/s] */
+const uint32_t BaudRate = 115200;
+
+/*! Bits of one character on the line (8N1) */
+const uint32_t CharacterBits = 10;
+
+/*! Interval of protocol handler task [ms] */
+const uint16_t TaskInterval = 1;
+
+/*! Address of node */
+const uint8_t NodeAddress = 0x01;
+
+/*! Command of requests answered with data (odd commands - no answer) */
+const uint8_t ReadCommand = 0x10;
+
+// --->Types
+
+/*! Frame parsed by host */
+typedef struct
+{
+	uint8_t Sequence;
+	uint8_t CommandID;
+	vector<uint8_t> Data;
+}HostFrame_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Commands of requests delivered to callback */
+static vector<uint8_t> DeliveredCommands;
+
+// --->Test classes
+
+/*! Test class for HENBUS controller tests with window */
+class TEST_CLASS(HENBUSWindowTest)
+{
+protected:
+	CommProtocolFrame_t WatchdogTest = { 0, 0xFE, 0, nullptr };
+	CommProtocolFrame_t WatchdogAnswer = { 0, 0xFF, 0, nullptr };
+	CommController_t Controller;
+
+	void SetUp() override
+	{
+		SerialPort_h_Mock::getInstance().Reset();
+		DeliveredCommands.clear();
+		Controller = HENBUSWindow::HENBUSCtrl_Init(&WatchdogTest,
+		                                           &WatchdogAnswer,
+		                                           SPN_USART0, nullptr,
+		                                           AnswerRequest, TaskInterval);
+	}
+
+	/*! Answers requests with even command (2 data bytes) */
+	static void AnswerRequest(CommProtocolFrame_t *frame)
+	{
+		static uint8_t data[2];
+		CommProtocolFrame_t answer = { frame->Address, frame->CommandID,
+		                               sizeof(data), data };
+
+		DeliveredCommands.push_back(frame->CommandID);
+
+		if (!(frame->CommandID & 1))
+		{
+			data[0] = frame->CommandID;
+			data[1] = (uint8_t)DeliveredCommands.size();
+			HENBUSCtrl_SendFrame(&answer);
+		}
+	}
+};
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Builds frame with node address - request or expected answer (data
+ *           without SOF and EOF)
+ * @param    sequence : sequence header
+ * @param    command : command code
+ * @param    dataSize : count of data bytes (values below 0x80)
+ * @retval   Frame bytes
+ */
+static vector<uint8_t> BuildRequest(uint8_t sequence, uint8_t command,
+                                    uint8_t dataSize)
+{
+	vector<uint8_t> frame;
+	uint8_t seed = 0;
+	HENBUSFCS_t crc;
+
+	do
+	{
+		frame = { HENBUS_SOF, NodeAddress, sequence, command, dataSize };
+		crc = HENBUS_FCS_INIT();
+		for (size_t index = 1; index < frame.size(); index++)
+		{
+			crc = HENBUS_FCS_UPDATE(crc, frame[index]);
+		}
+		for (uint8_t index = 0; index < dataSize; index++)
+		{
+			frame.push_back(seed + index);
+			crc = HENBUS_FCS_UPDATE(crc, (uint8_t)(seed + index));
+		}
+		crc = HENBUS_FCS_FINAL(crc);
+		for (int index = HENBUS_FCS_SIZE; index > 0; index--)
+		{
+			frame.push_back((uint8_t)(crc >> ((index - 1) * 8)));
+		}
+		frame.push_back(HENBUS_EOF);
+		seed++;
+	} while (dataSize &&
+	         (count(frame.begin() + 1, frame.end() - 1, HENBUS_SOF) ||
+	          count(frame.begin() + 1, frame.end() - 1, HENBUS_EOF)));
+
+	return frame;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Parses complete frames sent by node
+ * @param    &bytes : sent bytes
+ * @param    &index : index of first not parsed byte (updated)
+ * @retval   Parsed frames
+ */
+static vector<HostFrame_t> ParseFrames(const vector<uint8_t> &bytes,
+                                       size_t &index)
+{
+	const size_t headerLength = 5;
+	vector<HostFrame_t> frames;
+	size_t length;
+
+	while (index + headerLength < bytes.size())
+	{
+		length = headerLength + bytes[index + 4] + HENBUS_FCS_SIZE + 1;
+		if (index + length > bytes.size())
+		{
+			break;
+		}
+
+		frames.push_back({ bytes[index + 2], bytes[index + 3],
+			vector<uint8_t>(bytes.begin() + index + headerLength,
+			                bytes.begin() + index + headerLength +
+			                bytes[index + 4]) });
+		index += length;
+	}
+
+	return frames;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Puts bytes to receive buffer and calls handler
+ * @param    controller : HENBUS controller
+ * @param    &bytes : received bytes
+ * @retval   Bytes sent by node (whole transmit buffer)
+ */
+static vector<uint8_t> Exchange(CommController_t &controller,
+                                const vector<uint8_t> &bytes)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+
+	serialPort.SentBytes.clear();
+	for (uint8_t byte : bytes)
+	{
+		serialPort.ReceiveByte(byte);
+	}
+	controller.Handler();
+	serialPort.SendBytes(SP_TX_BUFF_SIZE);
+
+	return serialPort.SentBytes;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Simulates polling of node by host over 115200 b/s link
+ * @param    &controller : HENBUS controller
+ * @param    hostWindow : max. count of requests without answer
+ * @param    requestAmount : count of requests
+ * @param    &answers : answers received by host
+ * @retval   Time of transactions [ms]
+ */
+static int Poll(CommController_t &controller, int hostWindow,
+                int requestAmount, vector<HostFrame_t> &answers)
+{
+	SerialPort_h_Mock &serialPort = SerialPort_h_Mock::getInstance();
+	deque<uint8_t> hostTx;
+	uint32_t bitBudget = 0, characters;
+	size_t parsed = 0;
+	int sent = 0, outstanding = 0, ticks = 0;
+
+	while ((int)answers.size() < requestAmount && ticks < 100000)
+	{
+		// Requests sent while window of host is not full
+		for (; sent < requestAmount && outstanding < hostWindow;
+		     sent++, outstanding++)
+		{
+			vector<uint8_t> request = BuildRequest(
+				HENBUS_SEQ_DATA | (sent & HENBUS_SEQ_NUMBER_MASK),
+				ReadCommand, 0);
+
+			hostTx.insert(hostTx.end(), request.begin(), request.end());
+		}
+
+		// Characters sent in both directions during one task interval
+		bitBudget += BaudRate * TaskInterval / 1000;
+		characters = bitBudget / CharacterBits;
+		bitBudget %= CharacterBits;
+		for (uint32_t index = 0; index < characters && !hostTx.empty();
+		     index++)
+		{
+			serialPort.ReceiveByte(hostTx.front());
+			hostTx.pop_front();
+		}
+		serialPort.SendBytes(characters);
+
+		for (HostFrame_t &answer : ParseFrames(serialPort.SentBytes, parsed))
+		{
+			answers.push_back(answer);
+			outstanding--;
+		}
+
+		controller.Handler();
+		ticks++;
+	}
+
+	return ticks;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS window - requests sent without waiting are delivered in
+ * order, answered with their sequence numbers, requests without answer are
+ * acknowledged
+ */
+UNIT_TEST_F(HENBUSWindowTest_class, HENBUSWindowPipelineTest)
+{
+	size_t parsed = 0;
+	vector<uint8_t> requests, sent;
+	vector<HostFrame_t> answers;
+
+	for (uint8_t index = 0; index < HENBUS_WINDOW_SIZE; index++)
+	{
+		vector<uint8_t> request = BuildRequest(HENBUS_SEQ_DATA | (index + 8),
+		                                       ReadCommand + index, 0);
+
+		requests.insert(requests.end(), request.begin(), request.end());
+	}
+
+	sent = Exchange(Controller, requests);
+	answers = ParseFrames(sent, parsed);
+
+	EXPECT_EQ(DeliveredCommands, vector<uint8_t>({ 0x10, 0x11, 0x12, 0x13 }));
+	ASSERT_EQ(answers.size(), (size_t)HENBUS_WINDOW_SIZE);
+	for (uint8_t index = 0; index < HENBUS_WINDOW_SIZE; index++)
+	{
+		EXPECT_EQ(answers[index].Sequence, (index & 1 ? HENBUS_SEQ_ACK :
+		          HENBUS_SEQ_DATA) | (index + 8));
+		EXPECT_EQ(answers[index].CommandID, ReadCommand + index);
+		EXPECT_EQ(answers[index].Data.size(), index & 1 ? 0u : 2u);
+	}
+	EXPECT_EQ(vector<uint8_t>(sent.begin() + 8 + HENBUS_FCS_SIZE,
+	                          sent.begin() + 14 + HENBUS_FCS_SIZE * 2),
+	          BuildRequest(HENBUS_SEQ_ACK | 9, 0x11, 0));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS window - repeated request and NAK of answer are answered from
+ * cache without delivery, request with invalid CRC is answered with NAK and
+ * its retransmission is delivered
+ */
+UNIT_TEST_F(HENBUSWindowTest_class, HENBUSWindowRetransmitTest)
+{
+	vector<uint8_t> request = BuildRequest(HENBUS_SEQ_DATA | 5, ReadCommand, 3);
+	vector<uint8_t> answer, damaged;
+
+	// Repeated request and NAK of answer
+	answer = Exchange(Controller, request);
+	ASSERT_FALSE(answer.empty());
+	EXPECT_EQ(answer[2], HENBUS_SEQ_DATA | 5);
+	EXPECT_EQ(Exchange(Controller, request), answer);
+	EXPECT_EQ(Exchange(Controller, BuildRequest(HENBUS_SEQ_NAK | 5,
+	                                            ReadCommand, 0)), answer);
+	EXPECT_TRUE(Exchange(Controller, BuildRequest(HENBUS_SEQ_ACK | 5,
+	                                              ReadCommand, 0)).empty());
+	EXPECT_EQ(DeliveredCommands.size(), 1u);
+
+	// Request with invalid CRC and its retransmission
+	request = BuildRequest(HENBUS_SEQ_DATA | 6, ReadCommand + 2, 3);
+	damaged = request;
+	damaged[5] ^= 0x80;
+	EXPECT_EQ(Exchange(Controller, damaged),
+	          BuildRequest(HENBUS_SEQ_NAK | 6, ReadCommand + 2, 0));
+	EXPECT_EQ(DeliveredCommands.size(), 1u);
+	answer = Exchange(Controller, request);
+	ASSERT_FALSE(answer.empty());
+	EXPECT_EQ(answer[2], HENBUS_SEQ_DATA | 6);
+	EXPECT_EQ(DeliveredCommands.size(), 2u);
+
+	// Damaged repetition of answered request (NAK, cache kept)
+	EXPECT_EQ(Exchange(Controller, damaged),
+	          BuildRequest(HENBUS_SEQ_NAK | 6, ReadCommand + 2, 0));
+	EXPECT_EQ(Exchange(Controller, request), answer);
+	EXPECT_EQ(DeliveredCommands.size(), 2u);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS window - request with damaged header is answered with NAK,
+ * not with cached answer of request which header it resembles
+ */
+UNIT_TEST_F(HENBUSWindowTest_class, HENBUSWindowDamagedHeaderTest)
+{
+	vector<uint8_t> request = BuildRequest(HENBUS_SEQ_DATA | 5, ReadCommand, 3);
+	vector<uint8_t> answer, damaged;
+
+	answer = Exchange(Controller, request);
+	ASSERT_FALSE(answer.empty());
+	EXPECT_EQ(answer[2], HENBUS_SEQ_DATA | 5);
+
+	// Sequence number 7 damaged to number of answered request
+	request = BuildRequest(HENBUS_SEQ_DATA | 7, ReadCommand + 4, 3);
+	damaged = request;
+	damaged[2] ^= 0x02;
+	EXPECT_EQ(Exchange(Controller, damaged),
+	          BuildRequest(HENBUS_SEQ_NAK | 5, ReadCommand + 4, 0));
+	EXPECT_EQ(DeliveredCommands.size(), 1u);
+
+	// Retransmission delivered as new request
+	answer = Exchange(Controller, request);
+	ASSERT_FALSE(answer.empty());
+	EXPECT_EQ(answer[2], HENBUS_SEQ_DATA | 7);
+	EXPECT_EQ(answer[3], ReadCommand + 4);
+	EXPECT_EQ(DeliveredCommands, vector<uint8_t>({ ReadCommand,
+	                                               ReadCommand + 4 }));
+
+	// Damaged command of repeated request
+	damaged = request;
+	damaged[3] ^= 0x01;
+	EXPECT_EQ(Exchange(Controller, damaged),
+	          BuildRequest(HENBUS_SEQ_NAK | 7, ReadCommand + 5, 0));
+	EXPECT_EQ(Exchange(Controller, request), answer);
+	EXPECT_EQ(DeliveredCommands.size(), 2u);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of HENBUS window - frames outside window are delivered every time,
+ * frames sent outside delivery have no sequence number
+ */
+UNIT_TEST_F(HENBUSWindowTest_class, HENBUSWindowOutsideTest)
+{
+	vector<uint8_t> request = BuildRequest(HENBUS_SEQ_NONE, ReadCommand, 0);
+	CommProtocolFrame_t frame = { NodeAddress, 0x20, 0, nullptr };
+	vector<uint8_t> answer;
+
+	answer = Exchange(Controller, request);
+	ASSERT_FALSE(answer.empty());
+	EXPECT_EQ(answer[2], HENBUS_SEQ_NONE);
+	EXPECT_FALSE(Exchange(Controller, request).empty());
+	EXPECT_TRUE(Exchange(Controller,
+	                     BuildRequest(HENBUS_SEQ_NONE, ReadCommand + 1,
+	                                  0)).empty());
+	EXPECT_EQ(DeliveredCommands.size(), 3u);
+
+	EXPECT_TRUE(Controller.SendFrame(&frame));
+	EXPECT_EQ(Exchange(Controller, {}), BuildRequest(HENBUS_SEQ_NONE, 0x20, 0));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of HENBUS window - polling of node waiting for every answer and
+ * with window of requests (115200 b/s, handler called every 1 ms)
+ */
+UNIT_TEST_F(HENBUSWindowTest_class, HENBUSWindowThroughputTest)
+{
+	const int requestAmount = 200;
+	vector<HostFrame_t> answers[2];
+	int ticks[2];
+
+	ticks[0] = Poll(Controller, 1, requestAmount, answers[0]);
+	SetUp();
+	ticks[1] = Poll(Controller, HENBUS_WINDOW_SIZE, requestAmount, answers[1]);
+
+	printf("[ BENCH    ] HENBUS %u b/s: %d requests, stop-and-wait %d ms, "
+	       "window of %d %d ms\n",
+	       BaudRate, requestAmount, ticks[0], HENBUS_WINDOW_SIZE, ticks[1]);
+
+	EXPECT_EQ(SerialPort_h_Mock::getInstance().OverrunCounter, 0u);
+	for (int run = 0; run < 2; run++)
+	{
+		ASSERT_EQ(answers[run].size(), (size_t)requestAmount);
+		for (int index = 0; index < requestAmount; index++)
+		{
+			EXPECT_EQ(answers[run][index].Sequence,
+			          HENBUS_SEQ_DATA | (index & HENBUS_SEQ_NUMBER_MASK));
+		}
+	}
+	EXPECT_LT(ticks[1], ticks[0] * 2 / 3);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
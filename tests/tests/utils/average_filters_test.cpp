@@ -0,0 +1,369 @@
+/**
+ *******************************************************************************
+ * @file     average_filters_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file AverageFilters.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <numeric>
+#include <random>
+using namespace std;
+
+// --->User files
+
+#include "AverageFilters.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Filter 3 defined with macro (window of 8 samples) */
+AVG_FILTER3_DEFINE(DefinedFilter, 3);
+
+/*! Bank of filters 1 defined with macro (4 channels, time constant 2) */
+AVG_FILTER1_BANK_DEFINE(DefinedBank1, 4, 2);
+
+/*! Bank of filters 3 defined with macro (8 channels, window of 8) */
+AVG_FILTER_BANK_DEFINE(DefinedBank, 8, 3);
+
+/*! Median filter defined with macro (default window) */
+MEDIAN_FILTER_DEFINE(DefinedMedian, MF_SIZE);
+
+// --->Test classes
+
+/*! Test class for testing AverageFilter3 function (param: scale) */
+class TEST_CLASS_WITH_PARAM(AverageFilter3Test, uint8_t) { };
+
+/*! Test class for comparing AverageFilter3 with AverageFilter2 */
+class TEST_CLASS(AverageFilter3CompatibilityTest) { };
+
+/*! Test class for testing AVG_FILTER3_DEFINE macro */
+class TEST_CLASS(AverageFilter3DefineTest) { };
+
+/*! Test class for testing AverageFilterBank (param: channel amount) */
+class TEST_CLASS_WITH_PARAM(AverageFilterBankTest, uint8_t) { };
+
+/*! Test class for testing AverageFilter1Bank function */
+class TEST_CLASS(AverageFilter1BankTest) { };
+
+/*! Test class for testing MedianFilter function (param: window size) */
+class TEST_CLASS_WITH_PARAM(MedianFilterTest, uint8_t) { };
+
+/*! Test class for testing spike rejection of MedianFilter */
+class TEST_CLASS(MedianFilterSpikeTest) { };
+
+/*! Test class for testing MEDIAN_FILTER_DEFINE without initialization */
+class TEST_CLASS(MedianFilterDefineTest) { };
+
+/*! Test class for AverageFilterBank benchmark */
+class TEST_CLASS(AverageFilterBankBenchmark) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function AverageFilter3 - result is the mean of the window
+ */
+UNIT_TEST_WITH_PARAM(AverageFilter3Test, 1, 2, 3, 5, 8)
+{
+	const size_t window = 1 << GetParam();
+	int16_t buffer[256];
+	AvgFilter3_t filter;
+	deque<int32_t> samples(window, 0);
+	mt19937 generator(GetParam());
+	uniform_int_distribution<uint16_t> distribution(0, 4095);
+
+	AverageFilter3_Init(&filter, buffer, GetParam());
+
+	for (int index = 0; index < 1000; index++)
+	{
+		uint16_t sample = distribution(generator);
+
+		samples.pop_front();
+		samples.push_back(sample);
+
+		EXPECT_EQ(AverageFilter3(sample, &filter),
+		          accumulate(samples.begin(), samples.end(), 0) / window);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function AverageFilter3 - the same results as AverageFilter2 for
+ * the same window size
+ */
+UNIT_TEST(AverageFilter3CompatibilityTest)
+{
+	int16_t buffer[AVG_FILTER2_SIZE];
+	AvgFilter2_t filter2 = { 0 };
+	AvgFilter3_t filter3 = AVG_FILTER3_INIT(buffer, AVG_FILTER_SCALE);
+	mt19937 generator(0);
+	uniform_int_distribution<uint16_t> distribution(0, 1023);
+
+	memset(buffer, 0, sizeof(buffer));
+
+	for (int index = 0; index < 1000; index++)
+	{
+		uint16_t sample = distribution(generator);
+
+		EXPECT_EQ(AverageFilter3(sample, &filter3),
+		          AverageFilter2(sample, &filter2));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of macro AVG_FILTER3_DEFINE
+ */
+UNIT_TEST(AverageFilter3DefineTest)
+{
+	AVG_FILTER3_DEFINE(localFilter, 2);
+
+	EXPECT_EQ(sizeof(DefinedFilter_Buffer), 16u);
+	EXPECT_EQ(DefinedFilter.Scale, 3);
+	EXPECT_EQ(localFilter_Scale, 2);
+	for (int16_t sample : localFilter_Buffer)
+	{
+		EXPECT_EQ(sample, 0);
+	}
+
+	for (int index = 0; index < 7; index++)
+	{
+		EXPECT_EQ(AverageFilter3(800, &DefinedFilter), (index + 1) * 100);
+	}
+	EXPECT_EQ(AVG_FILTER3(DefinedFilter, 800), 800);
+
+	for (int index = 0; index < 4; index++)
+	{
+		EXPECT_EQ(AVG_FILTER3(localFilter, 400), (index + 1) * 100);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function AverageFilterBank and AVG_FILTER_BANK macro - the same
+ * results as AverageFilter3 called for each channel
+ */
+UNIT_TEST_WITH_PARAM(AverageFilterBankTest, 1, 3, 8)
+{
+	const uint8_t scale = 4;
+	const uint8_t channels = GetParam();
+	int32_t sums[8];
+	int16_t bankBuffer[8 << scale];
+	int16_t buffers[8][1 << scale];
+	AvgFilterBank_t bank;
+	AvgFilter3_t filters[8];
+	uint16_t samples[8];
+	uint16_t results[8];
+	uint16_t definedResults[8];
+	mt19937 generator(channels);
+	uniform_int_distribution<uint16_t> distribution(0, 4095);
+	AVG_FILTER_BANK_DEFINE(definedBank, 8, 4);
+
+	AverageFilterBank_Init(&bank, sums, bankBuffer, channels, scale);
+	for (int channel = 0; channel < channels; channel++)
+	{
+		AverageFilter3_Init(&filters[channel], buffers[channel], scale);
+	}
+
+	for (int scan = 0; scan < 200; scan++)
+	{
+		for (int channel = 0; channel < 8; channel++)
+		{
+			samples[channel] = distribution(generator);
+		}
+
+		AverageFilterBank(samples, results, &bank);
+		AVG_FILTER_BANK(definedBank, samples, definedResults);
+
+		for (int channel = 0; channel < channels; channel++)
+		{
+			EXPECT_EQ(results[channel],
+			          AverageFilter3(samples[channel], &filters[channel]));
+			EXPECT_EQ(definedResults[channel], results[channel]);
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function AverageFilter1Bank - the same results as AverageFilter1
+ * called for each channel
+ */
+UNIT_TEST(AverageFilter1BankTest)
+{
+	int32_t previousSamples[4] = { 7, 7, 7, 7 };
+	AvgFilter1Bank_t bank;
+	AvgFilter1_t filters[4] = { { 3, 0 }, { 3, 0 }, { 3, 0 }, { 3, 0 } };
+	AvgFilter1_t definedFilters[4] = { { 2, 0 }, { 2, 0 }, { 2, 0 }, { 2, 0 } };
+	uint16_t samples[4];
+	int32_t results[4];
+	int32_t definedResults[4];
+	mt19937 generator(1);
+	uniform_int_distribution<uint16_t> distribution(0, 4095);
+
+	AverageFilter1Bank_Init(&bank, previousSamples, 4, 3);
+	EXPECT_EQ(previousSamples[3], 0);
+
+	for (int scan = 0; scan < 100; scan++)
+	{
+		for (int channel = 0; channel < 4; channel++)
+		{
+			samples[channel] = distribution(generator);
+		}
+
+		AverageFilter1Bank(samples, results, &bank);
+		AverageFilter1Bank(samples, definedResults, &DefinedBank1);
+
+		for (int channel = 0; channel < 4; channel++)
+		{
+			EXPECT_EQ(results[channel],
+			          AverageFilter1(samples[channel], &filters[channel]));
+			EXPECT_EQ(definedResults[channel],
+			          AverageFilter1(samples[channel],
+			                         &definedFilters[channel]));
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of AverageFilterBank against AverageFilter3 called per channel
+ */
+UNIT_TEST(AverageFilterBankBenchmark)
+{
+	const int scans = 200000;
+	int16_t buffers[8][8];
+	AvgFilter3_t filters[8];
+	volatile uint16_t samples[8] = { 1, 100, 200, 300, 400, 500, 600, 700 };
+	uint16_t results[8];
+	chrono::duration<double, nano> perChannelTime, bankTime;
+
+	for (int channel = 0; channel < 8; channel++)
+	{
+		AverageFilter3_Init(&filters[channel], buffers[channel], 3);
+	}
+
+	auto start = chrono::steady_clock::now();
+	for (int scan = 0; scan < scans; scan++)
+	{
+		samples[0] = scan;
+		for (int channel = 0; channel < 8; channel++)
+		{
+			results[channel] = AverageFilter3(samples[channel],
+			                                  &filters[channel]);
+		}
+	}
+	perChannelTime = chrono::steady_clock::now() - start;
+
+	start = chrono::steady_clock::now();
+	for (int scan = 0; scan < scans; scan++)
+	{
+		samples[0] = scan;
+		AverageFilterBank(samples, results, &DefinedBank);
+	}
+	bankTime = chrono::steady_clock::now() - start;
+
+	printf("[ BENCH    ] 8 channels per call: %6.2f ns, bank: %6.2f ns "
+	       "per scan\n",
+	       perChannelTime.count() / scans, bankTime.count() / scans);
+	EXPECT_EQ(results[7], 700);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function MedianFilter - the same result as sorting the window
+ */
+UNIT_TEST_WITH_PARAM(MedianFilterTest, 1, 3, 5, 9, 31)
+{
+	int16_t history[31], sorted[31];
+	MedianFilter_t filter = { GetParam(), 0, history, sorted };
+	deque<int16_t> window(GetParam(), -5);
+	mt19937 generator(GetParam());
+	uniform_int_distribution<int16_t> distribution(-20, 20);
+
+	MedianFilter_Init(&filter, -5);
+
+	for (int index = 0; index < 2000; index++)
+	{
+		int16_t sample = distribution(generator);
+		vector<int16_t> expected;
+
+		window.pop_front();
+		window.push_back(sample);
+		expected.assign(window.begin(), window.end());
+		sort(expected.begin(), expected.end());
+
+		ASSERT_EQ(MedianFilter(sample, &filter), expected[GetParam() / 2]);
+		ASSERT_TRUE(is_sorted(sorted, sorted + GetParam()));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function MedianFilter - single spikes are rejected
+ */
+UNIT_TEST(MedianFilterSpikeTest)
+{
+	const int16_t input[] = { 100, 101, 4000, 102, 101, -3000, 100, 99, 100 };
+
+	MedianFilter_Init(&DefinedMedian, 100);
+
+	for (int16_t sample : input)
+	{
+		int16_t result = MedianFilter(sample, &DefinedMedian);
+
+		EXPECT_GE(result, 99);
+		EXPECT_LE(result, 102);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of macro MEDIAN_FILTER_DEFINE - filter works without MedianFilter_Init
+ * with window filled with zeros
+ */
+UNIT_TEST(MedianFilterDefineTest)
+{
+	MEDIAN_FILTER_DEFINE(localMedian, 7);
+	deque<int16_t> window(7, 0);
+	mt19937 generator(7);
+	uniform_int_distribution<int16_t> distribution(-100, 100);
+
+	for (int index = 0; index < 7; index++)
+	{
+		EXPECT_EQ(localMedian_History[index], 0);
+		EXPECT_EQ(localMedian_Sorted[index], 0);
+	}
+
+	for (int index = 0; index < 200; index++)
+	{
+		int16_t sample = distribution(generator);
+		vector<int16_t> expected;
+
+		window.pop_front();
+		window.push_back(sample);
+		expected.assign(window.begin(), window.end());
+		sort(expected.begin(), expected.end());
+
+		ASSERT_EQ(MedianFilter(sample, &localMedian), expected[3]);
+	}
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,328 @@
+/**
+ *******************************************************************************
+ * @file     biquad_filter_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file BiquadFilter.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "BiquadFilter.c"
+#include "base_test.h"
+
+/* Macros, constants and definitions section ---------------------------------*/
+
+// --->Constants
+
+/*! Sampling frequency of tested filters [Hz] */
+const double SamplingFrequency = 1000.0;
+
+/*! Amplitude of test signal (part of full scale) */
+const double TestAmplitude = 0.5;
+
+// --->Types
+
+/*! Coefficients of second order section in double precision */
+typedef struct
+{
+	double B0, B1, B2, A1, A2;
+}ReferenceSection_t;
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Low-pass 50 Hz, Q = 0.707 (fs = 1 kHz) followed by notch 50 Hz, Q = 5 */
+const BiquadQ15Coeffs_t MainsFilterCoeffs[] PROGMEM =
+{
+	{
+		BIQUAD_Q15_COEFF(0.020082822), BIQUAD_Q15_COEFF(0.040165643),
+		BIQUAD_Q15_COEFF(0.020082822), BIQUAD_Q15_COEFF(-1.560975798),
+		BIQUAD_Q15_COEFF(0.641307085)
+	},
+	{
+		BIQUAD_Q15_COEFF(0.970024592), BIQUAD_Q15_COEFF(-1.845096418),
+		BIQUAD_Q15_COEFF(0.970024592), BIQUAD_Q15_COEFF(-1.845096418),
+		BIQUAD_Q15_COEFF(0.940049183)
+	}
+};
+
+/*! Channels of filter sharing the coefficients */
+BIQUAD_Q15_DEFINE(MainsFilter1, MainsFilterCoeffs);
+BIQUAD_Q15_DEFINE(MainsFilter2, MainsFilterCoeffs);
+
+// --->Test classes
+
+/*! Test class for testing frequency response of Q15 filter (param: Hz) */
+class TEST_CLASS_WITH_PARAM(BiquadQ15ResponseTest, double) { };
+
+/*! Test class for testing frequency response of Q31 filter (param: Hz) */
+class TEST_CLASS_WITH_PARAM(BiquadQ31ResponseTest, double) { };
+
+/*! Test class for testing channels sharing coefficients */
+class TEST_CLASS(BiquadChannelsTest) { };
+
+/*! Test class for testing output saturation */
+class TEST_CLASS(BiquadSaturationTest) { };
+
+/*! Test class for testing state saturation */
+class TEST_CLASS(BiquadStateSaturationTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Designs reference sections: low-pass 50 Hz (Q = 0.707) and
+ *           notch 50 Hz (Q = 5) using RBJ formulas
+ * @param    None
+ * @retval   Reference sections
+ */
+static vector<ReferenceSection_t> DesignReference(void)
+{
+	const double omega = 2.0 * M_PI * 50.0 / SamplingFrequency;
+	double alpha = sin(omega) / (2.0 * 0.707);
+	double a0 = 1.0 + alpha;
+	vector<ReferenceSection_t> sections;
+
+	sections.push_back({ (1.0 - cos(omega)) / 2.0 / a0,
+	                     (1.0 - cos(omega)) / a0,
+	                     (1.0 - cos(omega)) / 2.0 / a0,
+	                     -2.0 * cos(omega) / a0,
+	                     (1.0 - alpha) / a0 });
+
+	alpha = sin(omega) / (2.0 * 5.0);
+	a0 = 1.0 + alpha;
+	sections.push_back({ 1.0 / a0,
+	                     -2.0 * cos(omega) / a0,
+	                     1.0 / a0,
+	                     -2.0 * cos(omega) / a0,
+	                     (1.0 - alpha) / a0 });
+
+	return sections;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Calculates gain of reference cascade
+ * @param    &sections : reference sections
+ * @param    frequency : frequency [Hz]
+ * @retval   Gain
+ */
+static double ReferenceGain(const vector<ReferenceSection_t> &sections,
+                            double frequency)
+{
+	complex<double> z1 = polar(1.0, -2.0 * M_PI * frequency /
+	                                SamplingFrequency);
+	complex<double> response = 1.0;
+
+	for (const ReferenceSection_t &section : sections)
+	{
+		response *= (section.B0 + section.B1 * z1 + section.B2 * z1 * z1) /
+		            (1.0 + section.A1 * z1 + section.A2 * z1 * z1);
+	}
+
+	return abs(response);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Measures gain of filter for sine input (after settling)
+ * @param    filter : filter function (input and output as part of full scale)
+ * @param    frequency : frequency [Hz]
+ * @retval   Gain
+ */
+template <typename Filter_t>
+static double MeasureGain(Filter_t filter, double frequency)
+{
+	const int settling = 2000;
+	const int length = (int)SamplingFrequency;
+	double inPhase = 0.0, quadrature = 0.0;
+
+	for (int index = 0; index < settling + length; index++)
+	{
+		double phase = 2.0 * M_PI * frequency * index / SamplingFrequency;
+		double output = filter(TestAmplitude * sin(phase));
+
+		if (index >= settling)
+		{
+			inPhase += output * sin(phase);
+			quadrature += output * cos(phase);
+		}
+	}
+
+	return 2.0 * hypot(inPhase, quadrature) / length / TestAmplitude;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function BiquadQ15 - gain equal to double precision reference
+ */
+UNIT_TEST_WITH_PARAM(BiquadQ15ResponseTest, 1, 10, 30, 45, 50, 55, 80, 150,
+                     300, 490)
+{
+	vector<ReferenceSection_t> reference = DesignReference();
+	BiquadQ15Coeffs_t coeffs[2];
+	BiquadQ15State_t states[2];
+	BiquadQ15_t filter;
+
+	for (size_t section = 0; section < reference.size(); section++)
+	{
+		coeffs[section] = { BIQUAD_Q15_COEFF(reference[section].B0),
+		                    BIQUAD_Q15_COEFF(reference[section].B1),
+		                    BIQUAD_Q15_COEFF(reference[section].B2),
+		                    BIQUAD_Q15_COEFF(reference[section].A1),
+		                    BIQUAD_Q15_COEFF(reference[section].A2) };
+	}
+	BiquadQ15_Init(&filter, coeffs, states, 2);
+
+	double gain = MeasureGain([&filter](double sample)
+	{
+		return BiquadQ15((int16_t)lround(sample * 32767), &filter) / 32767.0;
+	}, GetParam());
+
+	EXPECT_NEAR(gain, ReferenceGain(reference, GetParam()), 2e-3);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function BiquadQ31 - gain equal to double precision reference
+ */
+UNIT_TEST_WITH_PARAM(BiquadQ31ResponseTest, 1, 10, 30, 45, 50, 55, 80, 150,
+                     300, 490)
+{
+	vector<ReferenceSection_t> reference = DesignReference();
+	BiquadQ31Coeffs_t coeffs[2];
+	BiquadQ31State_t states[2];
+	BiquadQ31_t filter;
+
+	for (size_t section = 0; section < reference.size(); section++)
+	{
+		coeffs[section] = { BIQUAD_Q31_COEFF(reference[section].B0),
+		                    BIQUAD_Q31_COEFF(reference[section].B1),
+		                    BIQUAD_Q31_COEFF(reference[section].B2),
+		                    BIQUAD_Q31_COEFF(reference[section].A1),
+		                    BIQUAD_Q31_COEFF(reference[section].A2) };
+	}
+	BiquadQ31_Init(&filter, coeffs, states, 2);
+
+	double gain = MeasureGain([&filter](double sample)
+	{
+		return BiquadQ31((int32_t)llround(sample * 2147483647.0), &filter) /
+		       2147483647.0;
+	}, GetParam());
+
+	EXPECT_NEAR(gain, ReferenceGain(reference, GetParam()), 1e-6);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of channels sharing coefficients - states are independent
+ */
+UNIT_TEST(BiquadChannelsTest)
+{
+	BiquadQ15State_t states[2];
+	BiquadQ15_t filter;
+	mt19937 generator(0);
+	uniform_int_distribution<int16_t> distribution(-16000, 16000);
+
+	EXPECT_EQ(MainsFilter1.SectionAmount, 2);
+	BiquadQ15_Init(&filter, MainsFilterCoeffs, states, 2);
+
+	for (int index = 0; index < 1000; index++)
+	{
+		int16_t sample = distribution(generator);
+
+		BiquadQ15(index % 2 ? 16000 : -16000, &MainsFilter2);
+		EXPECT_EQ(BiquadQ15(sample, &MainsFilter1), BiquadQ15(sample, &filter));
+	}
+
+	BiquadQ15_Reset(&MainsFilter2);
+	EXPECT_EQ(MainsFilter2.States[0].S1, 0);
+	EXPECT_EQ(MainsFilter2.States[1].S2, 0);
+	EXPECT_EQ(BiquadQ15(0, &MainsFilter2), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of output saturation - section with gain 1.9 does not wrap around
+ */
+UNIT_TEST(BiquadSaturationTest)
+{
+	const BiquadQ15Coeffs_t coeffs16[] =
+		{ { BIQUAD_Q15_COEFF(1.9), 0, 0, 0, 0 } };
+	const BiquadQ31Coeffs_t coeffs32[] =
+		{ { BIQUAD_Q31_COEFF(1.9), 0, 0, 0, 0 } };
+	BiquadQ15State_t state16;
+	BiquadQ31State_t state32;
+	BiquadQ15_t filter16;
+	BiquadQ31_t filter32;
+
+	BiquadQ15_Init(&filter16, coeffs16, &state16, 1);
+	BiquadQ31_Init(&filter32, coeffs32, &state32, 1);
+
+	EXPECT_EQ(BiquadQ15(30000, &filter16), INT16_MAX);
+	EXPECT_EQ(BiquadQ15(-30000, &filter16), INT16_MIN);
+	EXPECT_EQ(BiquadQ15(1000, &filter16), 1900);
+	EXPECT_EQ(BiquadQ31(2000000000, &filter32), INT32_MAX);
+	EXPECT_EQ(BiquadQ31(-2000000000, &filter32), INT32_MIN);
+	EXPECT_NEAR(BiquadQ31(1000000, &filter32), 1900000, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of state saturation - unstable section stays at the positive limit
+ * instead of wrapping around
+ */
+UNIT_TEST(BiquadStateSaturationTest)
+{
+	const BiquadQ15Coeffs_t coeffs16[] =
+	{
+		{
+			BIQUAD_Q15_COEFF(1.9), BIQUAD_Q15_COEFF(1.9),
+			BIQUAD_Q15_COEFF(1.9), BIQUAD_Q15_COEFF(-2.0), 0
+		}
+	};
+	const BiquadQ31Coeffs_t coeffs32[] =
+	{
+		{
+			BIQUAD_Q31_COEFF(1.9), BIQUAD_Q31_COEFF(1.9),
+			BIQUAD_Q31_COEFF(1.9), BIQUAD_Q31_COEFF(-2.0), 0
+		}
+	};
+	BiquadQ15State_t state16;
+	BiquadQ31State_t state32;
+	BiquadQ15_t filter16;
+	BiquadQ31_t filter32;
+
+	BiquadQ15_Init(&filter16, coeffs16, &state16, 1);
+	BiquadQ31_Init(&filter32, coeffs32, &state32, 1);
+
+	for (int index = 0; index < 20; index++)
+	{
+		EXPECT_EQ(BiquadQ15(30000, &filter16), INT16_MAX);
+		EXPECT_EQ(BiquadQ31(2000000000, &filter32), INT32_MAX);
+	}
+	EXPECT_EQ(state16.S1, INT32_MAX);
+	EXPECT_EQ(state32.S1, INT64_MAX);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
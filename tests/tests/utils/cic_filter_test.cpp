@@ -0,0 +1,219 @@
+/**
+ *******************************************************************************
+ * @file     cic_filter_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file CICFilter.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <random>
+#include <tuple>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "CICFilter.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Types
+
+/*! Parameters of CIC filter: order, rate, shift */
+typedef tuple<uint8_t, uint8_t, uint8_t> CICParams_t;
+
+// --->Test classes
+
+/*! Test class for testing CICFilter function */
+class TEST_CLASS_WITH_PARAM(CICFilterTest, CICParams_t) { };
+
+/*! Test class for testing CICFilter gain */
+class TEST_CLASS_WITH_PARAM(CICFilterGainTest, CICParams_t) { };
+
+/*! Test class for testing CICFilter at the largest allowed order and rate */
+class TEST_CLASS_WITH_PARAM(CICFilterLimitTest, CICParams_t) { };
+
+/*! Test class for testing CICFilter_Init with invalid configuration */
+class TEST_CLASS(CICFilterInitTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference CIC filter - 'order' moving sums of 'rate' samples
+ *           followed by decimation
+ * @param    input : input samples
+ * @param    order : filter order
+ * @param    rate : decimation rate
+ * @param    shift : output shift
+ * @retval   Output samples
+ */
+static vector<uint16_t> ReferenceCIC(const vector<uint16_t> &input,
+                                     int order,
+                                     int rate,
+                                     int shift)
+{
+	vector<int64_t> signal(input.begin(), input.end());
+	vector<uint16_t> output;
+
+	for (int stage = 0; stage < order; stage++)
+	{
+		vector<int64_t> sums(signal.size(), 0);
+
+		for (size_t index = 0; index < signal.size(); index++)
+		{
+			for (int tap = 0; tap < rate && tap <= (int)index; tap++)
+			{
+				sums[index] += signal[index - tap];
+			}
+		}
+		signal = sums;
+	}
+
+	for (size_t index = rate - 1; index < signal.size(); index += rate)
+	{
+		output.push_back((uint16_t)(signal[index] >> shift));
+	}
+
+	return output;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CICFilter - comparison with reference implementation
+ */
+UNIT_TEST_WITH_PARAM(CICFilterTest,
+                     CICParams_t(1, 4, 2),
+                     CICParams_t(2, 8, 4),
+                     CICParams_t(3, 16, 8),
+                     CICParams_t(4, 16, 12),
+                     CICParams_t(3, 64, 16))
+{
+	uint8_t order = get<0>(GetParam());
+	uint8_t rate = get<1>(GetParam());
+	uint8_t shift = get<2>(GetParam());
+	vector<uint16_t> input;
+	vector<uint16_t> output;
+	mt19937 generator(rate);
+	uniform_int_distribution<uint16_t> distribution(0, 1023);
+	CICFilter_t filter;
+	uint16_t result;
+
+	for (int index = 0; index < rate * 40; index++)
+	{
+		input.push_back(distribution(generator));
+	}
+
+	CICFilter_Init(&filter, order, rate, shift);
+	for (uint16_t sample : input)
+	{
+		if (CICFilter(sample, &filter, &result))
+		{
+			output.push_back(result);
+		}
+	}
+
+	EXPECT_EQ(output, ReferenceCIC(input, order, rate, shift));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CICFilter - constant 10-bit input gives 14/16-bit output
+ */
+UNIT_TEST_WITH_PARAM(CICFilterGainTest,
+                     CICParams_t(2, 16, 4),
+                     CICParams_t(3, 16, 6),
+                     CICParams_t(3, 64, 12))
+{
+	CICFilter_t filter;
+	uint16_t result = 0;
+	int outputs = 0;
+	int expectedBits = 10 +
+	                   get<0>(GetParam()) * __builtin_ctz(get<1>(GetParam())) -
+	                   get<2>(GetParam());
+
+	CICFilter_Init(&filter, get<0>(GetParam()), get<1>(GetParam()),
+	               get<2>(GetParam()));
+
+	for (int index = 0; index < get<1>(GetParam()) * 10; index++)
+	{
+		outputs += CICFilter(1023, &filter, &result);
+	}
+
+	EXPECT_EQ(outputs, 10);
+	EXPECT_EQ(result, 1023u << (expectedBits - 10));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CICFilter - full-scale 10-bit input at the largest allowed
+ * order and rate does not wrap registers
+ */
+UNIT_TEST_WITH_PARAM(CICFilterLimitTest,
+                     CICParams_t(4, 32, 14),
+                     CICParams_t(3, 128, 15),
+                     CICParams_t(2, 255, 10))
+{
+	uint8_t order = get<0>(GetParam());
+	uint8_t rate = get<1>(GetParam());
+	uint8_t shift = get<2>(GetParam());
+	uint64_t gain = 1;
+	CICFilter_t filter;
+	uint16_t result = 0;
+	int outputs = 0;
+
+	for (int stage = 0; stage < order; stage++)
+	{
+		gain *= rate;
+	}
+
+	ASSERT_TRUE(CICFilter_Init(&filter, order, rate, shift));
+	EXPECT_EQ(filter.Order, order);
+
+	for (int index = 0; index < rate * 10; index++)
+	{
+		outputs += CICFilter(1023, &filter, &result);
+	}
+
+	EXPECT_EQ(outputs, 10);
+	EXPECT_EQ(result, (uint16_t)((1023 * gain) >> shift));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CICFilter_Init - order exceeding register bits is reduced
+ */
+UNIT_TEST(CICFilterInitTest)
+{
+	CICFilter_t filter;
+
+	EXPECT_FALSE(CICFilter_Init(&filter, 4, 64, 16));
+	EXPECT_EQ(filter.Order, 3);
+
+	EXPECT_FALSE(CICFilter_Init(&filter, 3, 255, 16));
+	EXPECT_EQ(filter.Order, 2);
+
+	EXPECT_FALSE(CICFilter_Init(&filter, CIC_MAX_ORDER + 1, 2, 4));
+	EXPECT_EQ(filter.Order, CIC_MAX_ORDER);
+
+	EXPECT_FALSE(CICFilter_Init(&filter, 1, 0, 0));
+	EXPECT_EQ(filter.Rate, 1);
+
+	EXPECT_TRUE(CICFilter_Init(&filter, 4, 32, 14));
+	EXPECT_EQ(filter.Order, 4);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,223 @@
+/**
+ *******************************************************************************
+ * @file     cobs_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file COBS.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "COBS.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Types
+
+/*! Data and encoded data */
+typedef struct
+{
+	vector<uint8_t> Data;
+	vector<uint8_t> Encoded;
+}COBSVector_t;
+
+// --->Test classes
+
+/*! Test class for testing COBS_Encode function */
+class TEST_CLASS(COBSEncodeTest) { };
+
+/*! Test class for testing encoding and decoding of random data */
+class TEST_CLASS(COBSRoundTripTest) { };
+
+/*! Test class for testing decoding byte by byte */
+class TEST_CLASS(COBSDecodeByteTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Creates sequence of bytes
+ * @param    first : first byte
+ * @param    last : last byte
+ * @retval   Bytes from first to last
+ */
+static vector<uint8_t> Sequence(int first, int last)
+{
+	vector<uint8_t> bytes(last - first + 1);
+
+	iota(bytes.begin(), bytes.end(), first);
+
+	return bytes;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Joins byte vectors
+ * @param    vectors : vectors to join
+ * @retval   Joined vector
+ */
+static vector<uint8_t> Join(initializer_list<vector<uint8_t>> vectors)
+{
+	vector<uint8_t> result;
+
+	for (const vector<uint8_t> &bytes : vectors)
+	{
+		result.insert(result.end(), bytes.begin(), bytes.end());
+	}
+
+	return result;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions COBS_Encode and COBS_Decode - examples of COBS paper
+ * (Cheshire and Baker) and Wikipedia
+ */
+UNIT_TEST(COBSEncodeTest)
+{
+	const vector<COBSVector_t> vectors =
+	{
+		{ {}, { 0x01 } },
+		{ { 0x00 }, { 0x01, 0x01 } },
+		{ { 0x00, 0x00 }, { 0x01, 0x01, 0x01 } },
+		{ { 0x00, 0x11, 0x00 }, { 0x01, 0x02, 0x11, 0x01 } },
+		{ { 0x11, 0x22, 0x00, 0x33 }, { 0x03, 0x11, 0x22, 0x02, 0x33 } },
+		{ { 0x11, 0x22, 0x33, 0x44 }, { 0x05, 0x11, 0x22, 0x33, 0x44 } },
+		{ { 0x11, 0x00, 0x00, 0x00 }, { 0x02, 0x11, 0x01, 0x01, 0x01 } },
+		{ Sequence(0x01, 0xFE), Join({ { 0xFF }, Sequence(0x01, 0xFE) }) },
+		{ Sequence(0x00, 0xFE),
+		  Join({ { 0x01, 0xFF }, Sequence(0x01, 0xFE) }) },
+		{ Sequence(0x01, 0xFF),
+		  Join({ { 0xFF }, Sequence(0x01, 0xFE), { 0x02, 0xFF } }) },
+		{ Join({ Sequence(0x02, 0xFF), { 0x00 } }),
+		  Join({ { 0xFF }, Sequence(0x02, 0xFF), { 0x01, 0x01 } }) },
+		{ Join({ Sequence(0x03, 0xFF), { 0x00, 0x01 } }),
+		  Join({ { 0xFE }, Sequence(0x03, 0xFF), { 0x02, 0x01 } }) }
+	};
+
+	for (const COBSVector_t &testVector : vectors)
+	{
+		vector<uint8_t> encoded(COBS_MAX_LENGTH(testVector.Data.size()));
+		vector<uint8_t> decoded(testVector.Data.size() + 1);
+
+		encoded.resize(COBS_Encode(encoded.data(), testVector.Data.data(),
+		                           testVector.Data.size()));
+		EXPECT_EQ(encoded, testVector.Encoded);
+
+		decoded.resize(COBS_Decode(decoded.data(), testVector.Encoded.data(),
+		                           testVector.Encoded.size()));
+		EXPECT_EQ(decoded, testVector.Data);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions COBS_Encode and COBS_Decode - random data with different
+ * density of zeros: no zero in encoded data, overhead not greater than
+ * COBS_MAX_LENGTH, decoded data equal to input, encoding in place
+ */
+UNIT_TEST(COBSRoundTripTest)
+{
+	mt19937 generator(0);
+
+	for (int length = 0; length < 1100; length += 1 + length / 8)
+	{
+		for (int zeroRate : { 0, 2, 50, 255 })
+		{
+			vector<uint8_t> data(length);
+			vector<uint8_t> encoded(COBS_MAX_LENGTH(length));
+			vector<uint8_t> buffer(COBS_MAX_LENGTH(length));
+			const size_t offset = COBS_MAX_LENGTH(length) - length;
+			uint16_t encodedLength;
+
+			for (uint8_t &byte : data)
+			{
+				byte = (int)(generator() % 256) < zeroRate ?
+					0 : 1 + generator() % 255;
+			}
+
+			encodedLength = COBS_Encode(encoded.data(), data.data(), length);
+			encoded.resize(encodedLength);
+			ASSERT_LE(encodedLength, COBS_MAX_LENGTH(length));
+			EXPECT_EQ(count(encoded.begin(), encoded.end(), COBS_DELIMITER), 0);
+
+			// Data at the end of buffer encoded to the beginning
+			copy(data.begin(), data.end(), buffer.begin() + offset);
+			ASSERT_EQ(COBS_Encode(buffer.data(), buffer.data() + offset,
+			                      length), encodedLength);
+			buffer.resize(encodedLength);
+			EXPECT_EQ(buffer, encoded);
+
+			// Decoding in place up to delimiter
+			buffer.push_back(COBS_DELIMITER);
+			buffer.push_back(0x55);
+			buffer.resize(COBS_Decode(buffer.data(), buffer.data(),
+			                          buffer.size()));
+			ASSERT_EQ(buffer, data);
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function COBS_DecodeByte - the same result as COBS_Decode, decoder
+ * complete at the end of encoded frame and not complete inside block
+ */
+UNIT_TEST(COBSDecodeByteTest)
+{
+	mt19937 generator(1);
+	COBSDecoder_t decoder;
+
+	for (int length : { 0, 1, 10, 253, 254, 255, 600 })
+	{
+		vector<uint8_t> data(length), decoded;
+		vector<uint8_t> encoded(COBS_MAX_LENGTH(length));
+
+		for (uint8_t &byte : data)
+		{
+			byte = generator() % 8 ? generator() : 0;
+		}
+		encoded.resize(COBS_Encode(encoded.data(), data.data(), length));
+
+		COBS_DecoderInit(&decoder);
+		for (uint8_t encodedByte : encoded)
+		{
+			int16_t byte = COBS_DecodeByte(&decoder, encodedByte);
+
+			if (byte >= 0)
+			{
+				decoded.push_back(byte);
+			}
+		}
+
+		EXPECT_TRUE(COBS_IsDecoderComplete(&decoder));
+		EXPECT_EQ(decoded, data);
+	}
+
+	// Frame cut inside block
+	COBS_DecoderInit(&decoder);
+	COBS_DecodeByte(&decoder, 0x05);
+	COBS_DecodeByte(&decoder, 0x11);
+	EXPECT_FALSE(COBS_IsDecoderComplete(&decoder));
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
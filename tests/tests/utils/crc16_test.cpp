@@ -0,0 +1,99 @@
+/**
+ *******************************************************************************
+ * @file     crc16_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file CRC16.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "CRC16.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Test classes
+
+/*! Test class for testing CRC16_Update function */
+class TEST_CLASS(CRC16UpdateTest) { };
+
+/*! Test class for testing CRC16_Block function */
+class TEST_CLASS(CRC16BlockTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference CRC-16/CCITT - bit by bit loop
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+static uint16_t ReferenceCRC16(uint16_t crc, uint8_t data)
+{
+	crc ^= (uint16_t)data << 8;
+	for (int bit = 0; bit < 8; bit++)
+	{
+		crc = crc & 0x8000 ? (crc << 1) ^ CRC16_POLYNOMIAL : crc << 1;
+	}
+
+	return crc;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CRC16_Update - the same results as bit by bit loop
+ */
+UNIT_TEST(CRC16UpdateTest)
+{
+	mt19937 generator(0);
+
+	for (int index = 0; index < 100000; index++)
+	{
+		uint16_t crc = generator();
+		uint8_t data = generator();
+
+		ASSERT_EQ(CRC16_Update(crc, data), ReferenceCRC16(crc, data));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CRC16_Block - check value and incremental calculation
+ */
+UNIT_TEST(CRC16BlockTest)
+{
+	const uint8_t check[] = "123456789";
+	vector<uint8_t> frame(300);
+	mt19937 generator(1);
+	uint16_t crc = CRC16_Init();
+
+	EXPECT_EQ(CRC16_Final(CRC16_Block(CRC16_Init(), check, 9)), 0x29B1);
+
+	for (uint8_t &byte : frame)
+	{
+		byte = generator();
+		crc = CRC16_Update(crc, byte);
+	}
+	EXPECT_EQ(CRC16_Final(crc),
+	          CRC16_Final(CRC16_Block(CRC16_Init(), frame.data(), frame.size())));
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
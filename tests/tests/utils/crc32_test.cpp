@@ -0,0 +1,99 @@
+/**
+ *******************************************************************************
+ * @file     crc32_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file CRC32.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#include "CRC32.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Test classes
+
+/*! Test class for testing CRC32_Update function */
+class TEST_CLASS(CRC32UpdateTest) { };
+
+/*! Test class for testing CRC32_Block function */
+class TEST_CLASS(CRC32BlockTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference CRC-32 - bit by bit loop
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+static uint32_t ReferenceCRC32(uint32_t crc, uint8_t data)
+{
+	crc ^= data;
+	for (int bit = 0; bit < 8; bit++)
+	{
+		crc = crc & 1 ? (crc >> 1) ^ CRC32_POLYNOMIAL : crc >> 1;
+	}
+
+	return crc;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CRC32_Update - the same results as bit by bit loop
+ */
+UNIT_TEST(CRC32UpdateTest)
+{
+	mt19937 generator(0);
+
+	for (int index = 0; index < 100000; index++)
+	{
+		uint32_t crc = generator();
+		uint8_t data = generator();
+
+		ASSERT_EQ(CRC32_Update(crc, data), ReferenceCRC32(crc, data));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CRC32_Block - check value and incremental calculation
+ */
+UNIT_TEST(CRC32BlockTest)
+{
+	const uint8_t check[] = "123456789";
+	vector<uint8_t> frame(300);
+	mt19937 generator(1);
+	uint32_t crc = CRC32_Init();
+
+	EXPECT_EQ(CRC32_Final(CRC32_Block(CRC32_Init(), check, 9)), 0xCBF43926u);
+
+	for (uint8_t &byte : frame)
+	{
+		byte = generator();
+		crc = CRC32_Update(crc, byte);
+	}
+	EXPECT_EQ(CRC32_Final(crc),
+	          CRC32_Final(CRC32_Block(CRC32_Init(), frame.data(), frame.size())));
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
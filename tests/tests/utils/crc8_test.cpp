@@ -0,0 +1,221 @@
+/**
+ *******************************************************************************
+ * @file     crc8_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file CRC8.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+using namespace std;
+
+// --->User files
+
+#define CRC8_ALL_STRATEGIES
+#include "CRC8.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Types
+
+/*! Function updating CRC with one byte */
+typedef uint8_t (*CRC8Update_t)(uint8_t crc, uint8_t data);
+
+// --->Test classes
+
+/*! Test class for testing CRC8 strategies (param: update function) */
+class TEST_CLASS_WITH_PARAM(CRC8StrategyTest, CRC8Update_t) { };
+
+/*! Test class for testing CRC8_Block function */
+class TEST_CLASS(CRC8BlockTest) { };
+
+/*! Test class for testing incremental CRC8 calculation */
+class TEST_CLASS(CRC8IncrementalTest) { };
+
+/*! Test class for CRC8 strategies benchmark */
+class TEST_CLASS(CRC8Benchmark) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference CRC8 - previous loop of CRC8() from Utils.c
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+static uint8_t ReferenceUtilsCRC8(uint8_t crc, uint8_t data)
+{
+	for (uint8_t bitCounter = 8; bitCounter > 0; bitCounter--)
+	{
+		uint8_t feedbackBit = (crc ^ data) & 0x01;
+
+		if (feedbackBit == 0x01)
+		{
+			crc = crc ^ 0x18;
+		}
+		crc = (crc >> 1) & 0x7F;
+		if (feedbackBit == 0x01)
+		{
+			crc = crc | 0x80;
+		}
+		data = data >> 1;
+	}
+
+	return crc;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference CRC8 - previous loop of OWI_CRC8() from OWICrc.c
+ * @param    crc : current CRC value
+ * @param    data : input byte
+ * @retval   Updated CRC value
+ */
+static uint8_t ReferenceOWICRC8(uint8_t crc, uint8_t data)
+{
+	for (uint8_t bitsLeft = 8; bitsLeft > 0; bitsLeft--)
+	{
+		if (((crc ^ data) & 0x01) == 0)
+		{
+			crc >>= 1;
+		}
+		else
+		{
+			crc ^= 0x18;
+			crc >>= 1;
+			crc |= 0x80;
+		}
+		data >>= 1;
+	}
+
+	return crc;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of CRC8 strategies - the same results as previous implementations for
+ * every CRC value and input byte
+ */
+UNIT_TEST_WITH_PARAM(CRC8StrategyTest,
+                     CRC8_UpdateBitwise,
+                     CRC8_UpdateNibble,
+                     CRC8_UpdateTable)
+{
+	for (int crc = 0; crc < 256; crc++)
+	{
+		for (int data = 0; data < 256; data++)
+		{
+			ASSERT_EQ(GetParam()(crc, data), ReferenceUtilsCRC8(crc, data));
+			ASSERT_EQ(GetParam()(crc, data), ReferenceOWICRC8(crc, data));
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function CRC8_Block - check value of CRC-8/MAXIM and 1-Wire ROM code
+ */
+UNIT_TEST(CRC8BlockTest)
+{
+	const uint8_t check[] = "123456789";
+	const uint8_t romCode[] = { 0x02, 0x1C, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xA2 };
+
+	EXPECT_EQ(CRC8_Block(CRC8_INIT_VALUE, check, 9), 0xA1);
+	EXPECT_EQ(CRC8_Block(CRC8_INIT_VALUE, romCode, 7), 0xA2);
+	EXPECT_EQ(CRC8_Block(CRC8_INIT_VALUE, romCode, 8), 0x00);
+	EXPECT_EQ(CRC8_Block(CRC8_Block(CRC8_INIT_VALUE, check, 4), check + 4, 5),
+	          0xA1);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions CRC8_Init, CRC8_Update and CRC8_Final - the same result
+ * as CRC8_Block, frame with appended CRC gives 0
+ */
+UNIT_TEST(CRC8IncrementalTest)
+{
+	vector<uint8_t> frame(100);
+	mt19937 generator(15);
+	uint8_t crc = CRC8_Init();
+
+	generate(frame.begin(), frame.end(), generator);
+
+	for (uint8_t byte : frame)
+	{
+		crc = CRC8_Update(crc, byte);
+	}
+	EXPECT_EQ(CRC8_Final(crc),
+	          CRC8_Block(CRC8_INIT_VALUE, frame.data(), frame.size()));
+
+	crc = CRC8_Update(crc, CRC8_Final(crc));
+	EXPECT_EQ(CRC8_Final(crc), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of CRC8 strategies (host bytes per cycle)
+ */
+UNIT_TEST(CRC8Benchmark)
+{
+	const struct
+	{
+		const char *Name;
+		CRC8Update_t Update;
+	} strategies[] =
+	{
+		{ "bitwise", CRC8_UpdateBitwise },
+		{ "nibble", CRC8_UpdateNibble },
+		{ "table", CRC8_UpdateTable }
+	};
+	vector<uint8_t> data(1 << 16);
+	mt19937 generator(0);
+	uint64_t cycles[3];
+	uint8_t results[3];
+
+	generate(data.begin(), data.end(), generator);
+
+	for (int strategy = 0; strategy < 3; strategy++)
+	{
+		CRC8Update_t update = strategies[strategy].Update;
+
+		cycles[strategy] = UINT64_MAX;
+		for (int run = 0; run < 5; run++)
+		{
+			uint8_t crc = CRC8_INIT_VALUE;
+			uint64_t start = ReadCycles();
+
+			for (uint8_t byte : data)
+			{
+				crc = update(crc, byte);
+			}
+			cycles[strategy] = min(cycles[strategy], ReadCycles() - start);
+			results[strategy] = crc;
+		}
+
+		printf("[ BENCH    ] CRC8 %-8s %6.4f bytes per cycle\n",
+		       strategies[strategy].Name,
+		       (double)data.size() / cycles[strategy]);
+	}
+
+	EXPECT_EQ(results[0], results[1]);
+	EXPECT_EQ(results[0], results[2]);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
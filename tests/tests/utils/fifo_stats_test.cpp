@@ -0,0 +1,91 @@
+/**
+ *******************************************************************************
+ * @file     fifo_stats_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file FIFO.c (occupancy statistics)
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// --->User files
+
+#define FIFO_STATS_ENABLED
+
+/*! Queue with statistics (second copy of queue in test program) */
+namespace FIFOStats
+{
+#include "FIFO.c"
+}
+using namespace FIFOStats;
+
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Test classes
+
+/*! Test class for testing occupancy statistics */
+class TEST_CLASS(FIFOStatsTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of occupancy statistics (FIFO_GetStats, FIFO_ResetStats,
+ * FIFO_StatsTick)
+ */
+UNIT_TEST(FIFOStatsTest)
+{
+	uint8_t buffer[8];
+	uint8_t block[6] = { 0 };
+	FIFOStats_t stats;
+	FIFO_t fifo;
+
+	FIFO_Init(&fifo, buffer, sizeof(buffer));
+	FIFO_GetStats(&fifo, &stats);
+	EXPECT_EQ(stats.PeakCount, 0);
+	EXPECT_EQ(stats.AddedCount, 0u);
+	EXPECT_EQ(stats.DroppedCount, 0u);
+	EXPECT_EQ(stats.FullTime, 0u);
+
+	FIFO_Add(&fifo, 1);
+	FIFO_Add(&fifo, 2);
+	FIFO_Add(&fifo, 3);
+	FIFO_Get(&fifo);
+	FIFO_StatsTick(&fifo);
+	EXPECT_EQ(FIFO_AddBlock(&fifo, block, sizeof(block)), 6);
+	FIFO_StatsTick(&fifo);
+	FIFO_Add(&fifo, 4);
+	EXPECT_EQ(FIFO_AddBlock(&fifo, block, sizeof(block)), 0);
+	FIFO_StatsTick(&fifo);
+	FIFO_GetBlock(&fifo, block, 5);
+	FIFO_StatsTick(&fifo);
+
+	FIFO_GetStats(&fifo, &stats);
+	EXPECT_EQ(stats.PeakCount, 8);
+	EXPECT_EQ(stats.AddedCount, 9u);
+	EXPECT_EQ(stats.DroppedCount, 7u);
+	EXPECT_EQ(stats.FullTime, 2u);
+
+	FIFO_ResetStats(&fifo);
+	FIFO_GetStats(&fifo, &stats);
+	EXPECT_EQ(stats.PeakCount, 3);
+	EXPECT_EQ(stats.AddedCount, 0u);
+	EXPECT_EQ(stats.DroppedCount, 0u);
+	EXPECT_EQ(stats.FullTime, 0u);
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -0,0 +1,358 @@
+/**
+ *******************************************************************************
+ * @file     fifo_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file FIFO.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+using namespace std;
+
+// --->User files
+
+#include "FIFO.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Test classes
+
+/*! Test class for testing FIFO_Init function */
+class TEST_CLASS_WITH_PARAM(FIFOInitTest, uint8_t) { };
+
+/*! Test class for testing order of FIFO_Add/FIFO_Get */
+class TEST_CLASS_WITH_PARAM(FIFOOrderTest, uint8_t) { };
+
+/*! Test class for testing FIFO_AddBlock/FIFO_GetBlock (param: offset) */
+class TEST_CLASS_WITH_PARAM(FIFOBlockTest, uint8_t) { };
+
+/*! Test class for testing FIFO_PeekSpan/FIFO_Consume (param: offset) */
+class TEST_CLASS_WITH_PARAM(FIFOPeekSpanTest, uint8_t) { };
+
+/*! Test class for testing SPSCFIFO_Add/SPSCFIFO_Get from one thread */
+class TEST_CLASS_WITH_PARAM(SPSCFIFOOrderTest, uint8_t) { };
+
+/*! Test class for SPSC queue stress test with two threads */
+class TEST_CLASS_WITH_PARAM(SPSCFIFOStressTest, uint8_t) { };
+
+/*! Test class for FIFO_Get benchmark */
+class TEST_CLASS(FIFOGetBenchmark) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Moves head and tail of empty queue to the specified index
+ * @param    *fifo : pointer to the queue
+ * @param    offset : index
+ * @retval   None
+ */
+static void MoveQueueTo(FIFO_t *fifo, uint8_t offset)
+{
+	for (int index = 0; index < offset; index++)
+	{
+		FIFO_Add(fifo, 0);
+		FIFO_Get(fifo);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Measures the time of Add/Get pair on nearly full queue
+ * @param    size : size of queue buffer
+ * @retval   Time of single pair in nanoseconds
+ */
+static double MeasureAddGetPair(uint8_t size)
+{
+	const int iterations = 200000;
+	const int runs = 5;
+	uint8_t buffer[256];
+	FIFO_t fifo;
+	volatile uint8_t sink = 0;
+	double best = 1e9;
+
+	FIFO_Init(&fifo, buffer, size);
+
+	// Queue is kept one item below capacity, so each Get works on the
+	// biggest possible Count.
+	for (int index = 0; index < fifo.Size - 1; index++)
+	{
+		FIFO_Add(&fifo, (uint8_t)index);
+	}
+
+	for (int run = 0; run < runs; run++)
+	{
+		auto start = chrono::steady_clock::now();
+
+		for (int index = 0; index < iterations; index++)
+		{
+			FIFO_Add(&fifo, (uint8_t)index);
+			sink = sink + FIFO_Get(&fifo);
+		}
+
+		chrono::duration<double, nano> elapsed =
+			chrono::steady_clock::now() - start;
+		best = min(best, elapsed.count() / iterations);
+	}
+
+	return best;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function FIFO_Init
+ */
+UNIT_TEST_WITH_PARAM(FIFOInitTest, 1, 2, 3, 8, 100, 128, 200, 255)
+{
+	uint8_t buffer[256];
+	FIFO_t fifo;
+
+	FIFO_Init(&fifo, buffer, GetParam());
+
+	EXPECT_TRUE(FIFO_IS_SIZE_VALID(fifo.Size));
+	EXPECT_LE(fifo.Size, GetParam());
+	EXPECT_GT(fifo.Size * 2, GetParam());
+	EXPECT_EQ(fifo.Mask, fifo.Size - 1);
+	EXPECT_EQ(fifo.Count, 0);
+	EXPECT_FALSE(fifo.IsQueueFull);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions FIFO_Add and FIFO_Get (order, wrapping and overflow)
+ */
+UNIT_TEST_WITH_PARAM(FIFOOrderTest, 1, 4, 8, 64, 128)
+{
+	uint8_t buffer[256];
+	FIFO_t fifo;
+	uint8_t expected = 0;
+	uint8_t next = 0;
+
+	FIFO_Init(&fifo, buffer, GetParam());
+
+	for (int round = 0; round < 3 * GetParam(); round++)
+	{
+		// Filling up to overflow
+		while (!fifo.IsQueueFull)
+		{
+			FIFO_Add(&fifo, next++);
+		}
+		next--;
+		EXPECT_EQ(fifo.Count, fifo.Size);
+
+		// Partial read to move the tail over the buffer end
+		for (int index = 0; index < (round % fifo.Size) + 1; index++)
+		{
+			EXPECT_EQ(FIFO_Get(&fifo), expected++);
+		}
+		EXPECT_FALSE(fifo.IsQueueFull);
+	}
+
+	while (fifo.Count)
+	{
+		EXPECT_EQ(FIFO_Get(&fifo), expected++);
+	}
+	EXPECT_EQ(expected, next);
+	EXPECT_EQ(FIFO_Get(&fifo), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions FIFO_AddBlock and FIFO_GetBlock
+ */
+UNIT_TEST_WITH_PARAM(FIFOBlockTest, 0, 1, 7, 15, 16, 31)
+{
+	FIFO_BUFFER_DEFINE(buffer, 32);
+	uint8_t input[40];
+	uint8_t output[40] = { 0 };
+	FIFO_t fifo;
+
+	for (int index = 0; index < sizeof(input); index++)
+	{
+		input[index] = (uint8_t)(index + 1);
+	}
+	FIFO_Init(&fifo, buffer, sizeof(buffer));
+	MoveQueueTo(&fifo, GetParam());
+
+	EXPECT_EQ(FIFO_AddBlock(&fifo, input, 20), 20);
+	EXPECT_FALSE(fifo.IsQueueFull);
+	EXPECT_EQ(FIFO_AddBlock(&fifo, input + 20, 20), 12);
+	EXPECT_TRUE(fifo.IsQueueFull);
+	EXPECT_EQ(fifo.Count, 32);
+
+	EXPECT_EQ(FIFO_GetBlock(&fifo, output, 5), 5);
+	EXPECT_EQ(FIFO_Get(&fifo), 6);
+	EXPECT_EQ(FIFO_GetBlock(&fifo, output + 6, 40), 26);
+	output[5] = 6;
+	EXPECT_EQ(fifo.Count, 0);
+	EXPECT_EQ(memcmp(input, output, 32), 0);
+	EXPECT_EQ(FIFO_GetBlock(&fifo, output, 40), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions FIFO_PeekSpan and FIFO_Consume
+ */
+UNIT_TEST_WITH_PARAM(FIFOPeekSpanTest, 0, 1, 10, 12, 15)
+{
+	uint8_t buffer[16];
+	FIFOSpan_t spans[2];
+	FIFO_t fifo;
+	uint8_t expected = 0;
+
+	FIFO_Init(&fifo, buffer, sizeof(buffer));
+	MoveQueueTo(&fifo, GetParam());
+	EXPECT_EQ(FIFO_PeekSpan(&fifo, spans), 0);
+	EXPECT_EQ(spans[0].Length + spans[1].Length, 0);
+
+	for (uint8_t index = 0; index < 12; index++)
+	{
+		FIFO_Add(&fifo, index);
+	}
+
+	EXPECT_EQ(FIFO_PeekSpan(&fifo, spans), 12);
+	EXPECT_EQ(spans[0].Length, min(12, 16 - GetParam()));
+	EXPECT_EQ(spans[0].Length + spans[1].Length, 12);
+	for (int span = 0; span < 2; span++)
+	{
+		for (int index = 0; index < spans[span].Length; index++)
+		{
+			EXPECT_EQ(spans[span].Data[index], expected++);
+		}
+	}
+
+	FIFO_Consume(&fifo, 5);
+	EXPECT_EQ(FIFO_Get(&fifo), 5);
+	FIFO_Consume(&fifo, 100);
+	EXPECT_EQ(fifo.Count, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions SPSCFIFO_Add, SPSCFIFO_Get and SPSCFIFO_Count
+ */
+UNIT_TEST_WITH_PARAM(SPSCFIFOOrderTest, 1, 8, 128, 255)
+{
+	uint8_t buffer[256];
+	SPSCFIFO_t fifo;
+	uint8_t expected = 0;
+	uint8_t next = 0;
+	uint8_t byte;
+
+	SPSCFIFO_Init(&fifo, buffer, GetParam());
+	EXPECT_TRUE(FIFO_IS_SIZE_VALID(fifo.Size));
+	EXPECT_LE(fifo.Size, 128);
+	EXPECT_FALSE(SPSCFIFO_Get(&fifo, &byte));
+
+	// Several rounds to wrap the free-running counters
+	for (int round = 0; round < 600; round++)
+	{
+		while (SPSCFIFO_Add(&fifo, next))
+		{
+			next++;
+		}
+		EXPECT_EQ(SPSCFIFO_Count(&fifo), fifo.Size);
+
+		for (int index = 0; index < (round % fifo.Size) + 1; index++)
+		{
+			ASSERT_TRUE(SPSCFIFO_Get(&fifo, &byte));
+			EXPECT_EQ(byte, expected++);
+		}
+	}
+
+	while (SPSCFIFO_Get(&fifo, &byte))
+	{
+		EXPECT_EQ(byte, expected++);
+	}
+	EXPECT_EQ(expected, next);
+	EXPECT_EQ(SPSCFIFO_Count(&fifo), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Stress test of SPSC queue - producer and consumer in separate threads.
+ * Consumer checks that the sequence has no lost or duplicated items.
+ */
+UNIT_TEST_WITH_PARAM(SPSCFIFOStressTest, 2, 16, 128)
+{
+	const uint32_t itemsCount = 500000;
+	uint8_t buffer[128];
+	SPSCFIFO_t fifo;
+	uint32_t received = 0;
+	uint32_t errors = 0;
+
+	SPSCFIFO_Init(&fifo, buffer, GetParam());
+
+	thread producer([&]()
+	{
+		for (uint32_t index = 0; index < itemsCount; index++)
+		{
+			while (!SPSCFIFO_Add(&fifo, (uint8_t)(index * 7)))
+			{
+				this_thread::yield();
+			}
+		}
+	});
+
+	thread consumer([&]()
+	{
+		uint8_t byte;
+
+		while (received < itemsCount)
+		{
+			if (SPSCFIFO_Get(&fifo, &byte))
+			{
+				if (byte != (uint8_t)(received * 7))
+				{
+					errors++;
+				}
+				received++;
+			}
+			else
+			{
+				this_thread::yield();
+			}
+		}
+	});
+
+	producer.join();
+	consumer.join();
+
+	EXPECT_EQ(received, itemsCount);
+	EXPECT_EQ(errors, 0u);
+	EXPECT_EQ(SPSCFIFO_Count(&fifo), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of FIFO_Get - cost should not depend on the queue size
+ */
+UNIT_TEST(FIFOGetBenchmark)
+{
+	const uint8_t sizes[] = { 8, 16, 32, 64, 128 };
+
+	for (uint8_t size : sizes)
+	{
+		printf("[ BENCH    ] FIFO size %3u: %6.2f ns per Add/Get\n",
+		       size, MeasureAddGetPair(size));
+	}
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
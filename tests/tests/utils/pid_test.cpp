@@ -0,0 +1,593 @@
+/**
+ *******************************************************************************
+ * @file     pid_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file PID.c
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <tuple>
+using namespace std;
+
+// --->User files
+
+#include "PID.c"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Variables
+
+/*! Bank of 8 controllers (heater zones) */
+PID_BANK_DEFINE(HeaterBank, 8);
+
+// --->Types
+
+/*! Gains of controller: P, I, D */
+typedef tuple<int16_t, int16_t, int16_t> PIDGains_t;
+
+// --->Test classes
+
+/*! Test class for testing PID_Handler function */
+class TEST_CLASS_WITH_PARAM(PIDHandlerTest, PIDGains_t) { };
+
+/*! Test class for PID_Handler benchmark */
+class TEST_CLASS(PIDHandlerBenchmark) { };
+
+/*! Test class for testing bank of independent controllers */
+class TEST_CLASS(PIDBankTest) { };
+
+/*! Test class for testing cascade links of bank */
+class TEST_CLASS(PIDBankCascadeTest) { };
+
+/*! Test class for testing invalid cascade links of bank */
+class TEST_CLASS(PIDBankInvalidTest) { };
+
+/*! Test class for PID_BankHandler benchmark */
+class TEST_CLASS(PIDBankBenchmark) { };
+
+/*! Test class for testing PIDVelocity_Handler as PI controller */
+class TEST_CLASS(PIDVelocityTest) { };
+
+/*! Test class for testing anti-windup of PIDVelocity_Handler */
+class TEST_CLASS(PIDVelocityWindupTest) { };
+
+/*! Test class for testing derivative filter of PIDVelocity_Handler */
+class TEST_CLASS(PIDVelocityDerivativeTest) { };
+
+/*! Test class for testing PIDVelocity_Handler with maximal gains */
+class TEST_CLASS(PIDVelocityOverflowTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Helpers
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Reference PID controller - previous implementation with 32-bit
+ *           division of output
+ * @param    setValue : set value
+ * @param    processValue : measured (process) value
+ * @param    *pid : pointer to the controller configuration structure
+ * @retval   Controller output
+ */
+static int16_t ReferencePID_Handler(int16_t setValue,
+                                    int16_t processValue,
+                                    PID_t *pid)
+{
+	int16_t error = setValue - pid->LastProcessValue;
+	int16_t p_term, d_term;
+	int32_t i_term, temp, result;
+
+	if (error > pid->MaxError)
+	{
+		p_term = MAX_INT;
+	}
+	else if (error < -pid->MaxError)
+	{
+		p_term = -MAX_INT;
+	}
+	else
+	{
+		p_term = pid->P_Factor * error;
+	}
+
+	temp = pid->SumError + error;
+	if (temp > pid->MaxSumError)
+	{
+		i_term = MAX_I_TERM;
+		pid->SumError = pid->MaxSumError;
+	}
+	else if (temp < -pid->MaxSumError)
+	{
+		i_term = -MAX_I_TERM;
+		pid->SumError = -pid->MaxSumError;
+	}
+	else
+	{
+		pid->SumError = temp;
+		i_term = pid->I_Factor * pid->SumError;
+	}
+
+	d_term = pid->D_Factor * (pid->LastProcessValue - processValue);
+	pid->LastProcessValue = processValue;
+
+	// Volatile divisor forces real division (as on AVR)
+	volatile int32_t divisor = PID_SCALING_FACTOR;
+	result = (p_term + i_term + d_term) / divisor;
+	if (result > MAX_INT)
+	{
+		result = MAX_INT;
+	}
+	else if (result < -MAX_INT)
+	{
+		result = -MAX_INT;
+	}
+
+	return (int16_t)result;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * @brief    Simulates step response of first-order plant (time constant of
+ *           16 ticks, actuator 0 - 1000) with given controller
+ * @param    controller : controller function (set value, process value)
+ * @param    *overshoot : maximal process value above set value
+ * @retval   Settling time (ticks) to +/-1% of set value
+ */
+template <typename Controller_t>
+static int SimulateStep(Controller_t controller, int *overshoot)
+{
+	const int setValue = 900;
+	int processValue = 0;
+	int settlingTime = 0;
+
+	*overshoot = 0;
+	for (int tick = 0; tick < 3000; tick++)
+	{
+		int output = controller(setValue, processValue);
+
+		output = max(0, min(1000, output));
+		processValue += (output - processValue) / 16;
+
+		*overshoot = max(*overshoot, processValue - setValue);
+		if (abs(processValue - setValue) > setValue / 100)
+		{
+			settlingTime = tick + 1;
+		}
+	}
+
+	return settlingTime;
+}
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PID_Handler - the same outputs as division based version
+ * (also for negative outputs)
+ */
+UNIT_TEST_WITH_PARAM(PIDHandlerTest,
+                     PIDGains_t(1, 0, 0),
+                     PIDGains_t(128, 1, 0),
+                     PIDGains_t(300, 20, 50),
+                     PIDGains_t(37, 3, 11),
+                     PIDGains_t(2000, 100, 0))
+{
+	PID_t pid = { 0 }, reference = { 0 };
+	mt19937 generator(get<0>(GetParam()));
+	uniform_int_distribution<int16_t> distribution(-1000, 1000);
+
+	pid.P_Factor = reference.P_Factor = get<0>(GetParam());
+	pid.I_Factor = reference.I_Factor = get<1>(GetParam());
+	pid.D_Factor = reference.D_Factor = get<2>(GetParam());
+	PID_Init(&pid);
+	PID_Init(&reference);
+
+	for (int index = 0; index < 5000; index++)
+	{
+		int16_t setValue = distribution(generator);
+		int16_t processValue = distribution(generator);
+
+		ASSERT_EQ(PID_Handler(setValue, processValue, &pid),
+		          ReferencePID_Handler(setValue, processValue, &reference));
+		ASSERT_EQ(pid.SumError, reference.SumError);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of PID_Handler against division based version (host cycles)
+ */
+UNIT_TEST(PIDHandlerBenchmark)
+{
+	const int calls = 1000000;
+	PID_t pid = { 0 }, reference = { 0 };
+	volatile int16_t processValue = 0;
+	int32_t checksum = 0, referenceChecksum = 0;
+	uint64_t shiftCycles = UINT64_MAX, divisionCycles = UINT64_MAX;
+
+	pid.P_Factor = reference.P_Factor = 300;
+	pid.I_Factor = reference.I_Factor = 20;
+	pid.D_Factor = reference.D_Factor = 50;
+	PID_Init(&pid);
+	PID_Init(&reference);
+
+	uint64_t start;
+
+	// Best of several runs (less noise from other processes)
+	for (int run = 0; run < 5; run++)
+	{
+		start = ReadCycles();
+		for (int index = 0; index < calls; index++)
+		{
+			processValue = (index & 0x3FF) - 512;
+			referenceChecksum += ReferencePID_Handler(0, processValue,
+			                                          &reference);
+		}
+		divisionCycles = min(divisionCycles, ReadCycles() - start);
+
+		start = ReadCycles();
+		for (int index = 0; index < calls; index++)
+		{
+			processValue = (index & 0x3FF) - 512;
+			checksum += PID_Handler(0, processValue, &pid);
+		}
+		shiftCycles = min(shiftCycles, ReadCycles() - start);
+	}
+
+	printf("[ BENCH    ] PID_Handler division: %6.2f, shift: %6.2f "
+	       "cycles per call\n",
+	       (double)divisionCycles / calls, (double)shiftCycles / calls);
+	EXPECT_EQ(checksum, referenceChecksum);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PID_BankHandler - the same outputs as PID_Handler called
+ * for each controller
+ */
+UNIT_TEST(PIDBankTest)
+{
+	PID_t pids[8];
+	int16_t setValues[8], processValues[8], outputs[8];
+	mt19937 generator(8);
+	uniform_int_distribution<int16_t> distribution(-1000, 1000);
+
+	for (int loop = 0; loop < 8; loop++)
+	{
+		pids[loop] = { 0 };
+		pids[loop].P_Factor = HeaterBank_P_Factors[loop] = 100 + loop * 20;
+		pids[loop].I_Factor = HeaterBank_I_Factors[loop] = loop;
+		pids[loop].D_Factor = HeaterBank_D_Factors[loop] = 8 - loop;
+		HeaterBank_CascadeSources[loop] = PID_BANK_EXTERNAL;
+		PID_Init(&pids[loop]);
+	}
+	ASSERT_TRUE(PID_BankInit(&HeaterBank));
+
+	for (int tick = 0; tick < 1000; tick++)
+	{
+		for (int loop = 0; loop < 8; loop++)
+		{
+			setValues[loop] = distribution(generator);
+			processValues[loop] = distribution(generator);
+		}
+
+		PID_BankHandler(setValues, processValues, outputs, &HeaterBank);
+
+		for (int loop = 0; loop < 8; loop++)
+		{
+			ASSERT_EQ(outputs[loop], PID_Handler(setValues[loop],
+			                                     processValues[loop],
+			                                     &pids[loop]));
+		}
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of cascade links - loop 1 drives loop 2, which drives loop 0, all
+ * resolved in one call
+ */
+UNIT_TEST(PIDBankCascadeTest)
+{
+	int16_t pFactors[3] = { 200, 150, 130 };
+	int16_t iFactors[3] = { 2, 1, 3 };
+	int16_t dFactors[3] = { 10, 0, 5 };
+	uint8_t sources[3] = { PID_BANK_SOURCE(2), PID_BANK_EXTERNAL,
+	                       PID_BANK_SOURCE(1) };
+	int16_t lastProcessValues[3], maxErrors[3];
+	int32_t sumErrors[3], maxSumErrors[3];
+	uint8_t order[3];
+	PIDBank_t bank = { 3, pFactors, iFactors, dFactors, sources,
+	                   lastProcessValues, sumErrors, maxErrors, maxSumErrors,
+	                   order };
+	PID_t pids[3];
+	int16_t setValues[3] = { 0, 0, 0 };
+	int16_t processValues[3], outputs[3];
+	mt19937 generator(3);
+	uniform_int_distribution<int16_t> distribution(-500, 500);
+
+	for (int loop = 0; loop < 3; loop++)
+	{
+		pids[loop] = { 0 };
+		pids[loop].P_Factor = pFactors[loop];
+		pids[loop].I_Factor = iFactors[loop];
+		pids[loop].D_Factor = dFactors[loop];
+		PID_Init(&pids[loop]);
+	}
+	ASSERT_TRUE(PID_BankInit(&bank));
+	EXPECT_EQ(order[0], 1);
+	EXPECT_EQ(order[1], 2);
+	EXPECT_EQ(order[2], 0);
+
+	for (int tick = 0; tick < 1000; tick++)
+	{
+		int16_t outer, middle;
+
+		setValues[1] = distribution(generator);
+		for (int loop = 0; loop < 3; loop++)
+		{
+			processValues[loop] = distribution(generator);
+		}
+
+		PID_BankHandler(setValues, processValues, outputs, &bank);
+
+		outer = PID_Handler(setValues[1], processValues[1], &pids[1]);
+		middle = PID_Handler(outer, processValues[2], &pids[2]);
+		ASSERT_EQ(outputs[1], outer);
+		ASSERT_EQ(outputs[2], middle);
+		ASSERT_EQ(outputs[0], PID_Handler(middle, processValues[0], &pids[0]));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PID_BankInit - cycles and invalid sources are rejected
+ */
+UNIT_TEST(PIDBankInvalidTest)
+{
+	int16_t factors[3] = { 1, 1, 1 };
+	uint8_t sources[3] = { PID_BANK_EXTERNAL, PID_BANK_SOURCE(2),
+	                       PID_BANK_SOURCE(1) };
+	int16_t lastProcessValues[3], maxErrors[3];
+	int32_t sumErrors[3], maxSumErrors[3];
+	uint8_t order[3];
+	PIDBank_t bank = { 3, factors, factors, factors, sources,
+	                   lastProcessValues, sumErrors, maxErrors, maxSumErrors,
+	                   order };
+
+	EXPECT_FALSE(PID_BankInit(&bank));
+
+	sources[2] = PID_BANK_SOURCE(3);
+	EXPECT_FALSE(PID_BankInit(&bank));
+
+	sources[2] = PID_BANK_SOURCE(0);
+	EXPECT_TRUE(PID_BankInit(&bank));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of PID_BankHandler against PID_Handler called per controller
+ */
+UNIT_TEST(PIDBankBenchmark)
+{
+	const int ticks = 200000;
+	PID_t pids[8];
+	int16_t setValues[8] = { 0 };
+	volatile int16_t processValues[8] = { 0 };
+	int16_t outputs[8];
+	uint64_t perLoopCycles = UINT64_MAX, bankCycles = UINT64_MAX;
+
+	for (int loop = 0; loop < 8; loop++)
+	{
+		pids[loop] = { 0 };
+		pids[loop].P_Factor = HeaterBank_P_Factors[loop] = 300;
+		pids[loop].I_Factor = HeaterBank_I_Factors[loop] = 20;
+		pids[loop].D_Factor = HeaterBank_D_Factors[loop] = 50;
+		HeaterBank_CascadeSources[loop] = PID_BANK_EXTERNAL;
+		PID_Init(&pids[loop]);
+	}
+	PID_BankInit(&HeaterBank);
+
+	uint64_t start;
+
+	for (int run = 0; run < 5; run++)
+	{
+		start = ReadCycles();
+		for (int tick = 0; tick < ticks; tick++)
+		{
+			processValues[0] = (tick & 0x3FF) - 512;
+			for (int loop = 0; loop < 8; loop++)
+			{
+				outputs[loop] = PID_Handler(setValues[loop],
+				                            processValues[loop], &pids[loop]);
+			}
+		}
+		perLoopCycles = min(perLoopCycles, ReadCycles() - start);
+
+		start = ReadCycles();
+		for (int tick = 0; tick < ticks; tick++)
+		{
+			processValues[0] = (tick & 0x3FF) - 512;
+			PID_BankHandler(setValues, (const int16_t *)processValues,
+			                outputs, &HeaterBank);
+		}
+		bankCycles = min(bankCycles, ReadCycles() - start);
+	}
+
+	printf("[ BENCH    ] 8 PID loops per call: %6.2f, bank: %6.2f "
+	       "cycles per tick\n",
+	       (double)perLoopCycles / ticks, (double)bankCycles / ticks);
+	EXPECT_EQ(outputs[7], 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PIDVelocity_Handler - without derivative and saturation
+ * the same output as positional PI controller
+ */
+UNIT_TEST(PIDVelocityTest)
+{
+	PIDVelocity_t pid = { 0 };
+	int64_t sumErrors = 0;
+	int16_t firstError = 0;
+	mt19937 generator(13);
+	uniform_int_distribution<int16_t> distribution(-300, 300);
+
+	pid.P_Factor = 200;
+	pid.I_Factor = 3;
+	pid.B_Factor = PID_SCALING_FACTOR;
+	pid.MinOutput = -MAX_INT;
+	pid.MaxOutput = MAX_INT;
+	PIDVelocity_Init(&pid, 0, 0, 0);
+
+	for (int tick = 0; tick < 2000; tick++)
+	{
+		int16_t setValue = distribution(generator);
+		int16_t processValue = distribution(generator);
+		int16_t error = setValue - processValue;
+		int64_t expected;
+
+		sumErrors += error;
+		expected = (200 * (error - firstError) + 3 * sumErrors) /
+		           PID_SCALING_FACTOR;
+		expected = max<int64_t>(-MAX_INT, min<int64_t>(MAX_INT, expected));
+
+		ASSERT_EQ(PIDVelocity_Handler(setValue, processValue, &pid), expected);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PIDVelocity_Handler - after actuator saturation
+ * back-calculation gives less overshoot and faster settling than clamping of
+ * sum of errors (PID_Handler) and than no anti-windup
+ */
+UNIT_TEST(PIDVelocityWindupTest)
+{
+	PID_t positional = { 0 };
+	PIDVelocity_t velocity = { 0 };
+	int overshoot, positionalOvershoot, noAntiWindupOvershoot;
+	int settlingTime, positionalSettlingTime, noAntiWindupSettlingTime;
+
+	positional.P_Factor = 128;
+	positional.I_Factor = 32;
+	PID_Init(&positional);
+	positionalSettlingTime = SimulateStep([&positional](int set, int process)
+	{
+		return PID_Handler(set, process, &positional);
+	}, &positionalOvershoot);
+
+	velocity.P_Factor = 128;
+	velocity.I_Factor = 32;
+	velocity.D_Factor = 0;
+	velocity.MinOutput = 0;
+	velocity.MaxOutput = 1000;
+	velocity.B_Factor = 0;
+	PIDVelocity_Init(&velocity, 0, 0, 0);
+	noAntiWindupSettlingTime = SimulateStep([&velocity](int set, int process)
+	{
+		return PIDVelocity_Handler(set, process, &velocity);
+	}, &noAntiWindupOvershoot);
+
+	velocity.B_Factor = PID_SCALING_FACTOR;
+	PIDVelocity_Init(&velocity, 0, 0, 0);
+	settlingTime = SimulateStep([&velocity](int set, int process)
+	{
+		return PIDVelocity_Handler(set, process, &velocity);
+	}, &overshoot);
+
+	printf("[ INFO     ] Overshoot / settling: clamped sum %d / %d, "
+	       "no anti-windup %d / %d, back-calculation %d / %d\n",
+	       positionalOvershoot, positionalSettlingTime,
+	       noAntiWindupOvershoot, noAntiWindupSettlingTime,
+	       overshoot, settlingTime);
+	EXPECT_LT(overshoot, positionalOvershoot);
+	EXPECT_LT(overshoot, noAntiWindupOvershoot);
+	EXPECT_LT(settlingTime, positionalSettlingTime);
+	EXPECT_LT(settlingTime, noAntiWindupSettlingTime);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PIDVelocity_Handler - derivative filter attenuates noise
+ * of process value
+ */
+UNIT_TEST(PIDVelocityDerivativeTest)
+{
+	double variances[2];
+	const uint8_t filterShifts[2] = { 0, 3 };
+
+	for (int index = 0; index < 2; index++)
+	{
+		PIDVelocity_t pid = { 0 };
+		mt19937 generator(0);
+		uniform_int_distribution<int16_t> noise(-20, 20);
+		double sum = 0.0, squareSum = 0.0;
+		const int ticks = 5000;
+
+		pid.D_Factor = 256;
+		pid.FilterShift = filterShifts[index];
+		pid.MinOutput = -MAX_INT;
+		pid.MaxOutput = MAX_INT;
+		PIDVelocity_Init(&pid, 500, 500, 0);
+
+		for (int tick = 0; tick < ticks; tick++)
+		{
+			int16_t output = PIDVelocity_Handler(500, 500 + noise(generator),
+			                                     &pid);
+
+			sum += output;
+			squareSum += (double)output * output;
+		}
+
+		variances[index] = squareSum / ticks - (sum / ticks) * (sum / ticks);
+	}
+
+	EXPECT_LT(variances[1] * 4, variances[0]);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of function PIDVelocity_Handler - full-scale error steps with maximal
+ * gains saturate output in the direction of error
+ */
+UNIT_TEST(PIDVelocityOverflowTest)
+{
+	PIDVelocity_t pid = { 0 };
+	const int16_t setValues[] = { MAX_INT, -MAX_INT, 0, 0, MAX_INT };
+	const int16_t processValues[] = { 0, 0, -MAX_INT, MAX_INT, 0 };
+
+	pid.P_Factor = MAX_INT;
+	pid.I_Factor = MAX_INT;
+	pid.D_Factor = MAX_INT;
+	pid.B_Factor = PID_SCALING_FACTOR;
+	pid.MinOutput = -MAX_INT;
+	pid.MaxOutput = MAX_INT;
+	PIDVelocity_Init(&pid, 0, 0, 0);
+
+	for (int step = 0; step < 5; step++)
+	{
+		int16_t output = PIDVelocity_Handler(setValues[step],
+		                                     processValues[step], &pid);
+
+		EXPECT_EQ(output, setValues[step] - processValues[step] > 0 ?
+		                  MAX_INT : -MAX_INT) << "step " << step;
+		EXPECT_LE(pid.OutputSum, PID_VELOCITY_MAX_SUM);
+		EXPECT_GE(pid.OutputSum, -PID_VELOCITY_MAX_SUM);
+	}
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
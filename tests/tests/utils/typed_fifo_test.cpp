@@ -0,0 +1,120 @@
+/**
+ *******************************************************************************
+ * @file     typed_fifo_test.cpp
+ * @author   HENIUS (Paweł Witak)
+ * @version  1.0.0
+ * @date     17-10-2026
+ * @brief    Tests of file TypedFIFO.h
+ *******************************************************************************
+ *
+ * <h2><center>COPYRIGHT 2026 HENIUS</center></h2>
+ */
+
+/* Include section -----------------------------------------------------------*/
+
+// --->System files
+
+using namespace std;
+
+// --->User files
+
+#include "TypedFIFO.h"
+#include "base_test.h"
+
+/* Declaration section -------------------------------------------------------*/
+
+// --->Types
+
+/*! Frame descriptor used as queue item */
+typedef struct
+{
+	uint8_t *Data;							/*!< Frame data */
+	uint8_t Length;							/*!< Frame length */
+}FrameDescriptor_t;
+
+/*! Queue of ADC samples */
+TYPED_FIFO_DEFINE(SampleFIFO, uint16_t, 16)
+
+/*! Queue of frame descriptors */
+TYPED_FIFO_DEFINE(FrameFIFO, FrameDescriptor_t, 4)
+
+// --->Test classes
+
+/*! Test class for testing queue of 16-bit samples */
+class TEST_CLASS(SampleFIFOTest) { };
+
+/*! Test class for testing queue of structures */
+class TEST_CLASS(FrameFIFOTest) { };
+
+/* Function section ----------------------------------------------------------*/
+
+// --->Tests
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of queue with uint16_t items
+ */
+UNIT_TEST(SampleFIFOTest)
+{
+	SampleFIFO_t fifo;
+	uint16_t next = 0xFF00;
+	uint16_t expected = next;
+	uint16_t sample;
+
+	SampleFIFO_Init(&fifo);
+	EXPECT_FALSE(SampleFIFO_Get(&fifo, &sample));
+
+	for (int round = 0; round < 100; round++)
+	{
+		while (SampleFIFO_Add(&fifo, next))
+		{
+			next += 0x11;
+		}
+		EXPECT_EQ(SampleFIFO_Count(&fifo), 16);
+
+		for (int index = 0; index <= round % 16; index++)
+		{
+			ASSERT_TRUE(SampleFIFO_Get(&fifo, &sample));
+			EXPECT_EQ(sample, expected);
+			expected += 0x11;
+		}
+	}
+
+	while (SampleFIFO_Get(&fifo, &sample))
+	{
+		EXPECT_EQ(sample, expected);
+		expected += 0x11;
+	}
+	EXPECT_EQ(expected, next);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of queue with structure items
+ */
+UNIT_TEST(FrameFIFOTest)
+{
+	uint8_t frames[5][8];
+	FrameFIFO_t fifo;
+	FrameDescriptor_t frame;
+
+	FrameFIFO_Init(&fifo);
+
+	for (uint8_t index = 0; index < 5; index++)
+	{
+		frame.Data = frames[index];
+		frame.Length = index + 1;
+
+		EXPECT_EQ(FrameFIFO_Add(&fifo, frame), index < 4);
+	}
+
+	for (uint8_t index = 0; index < 4; index++)
+	{
+		ASSERT_TRUE(FrameFIFO_Get(&fifo, &frame));
+		EXPECT_EQ(frame.Data, frames[index]);
+		EXPECT_EQ(frame.Length, index + 1);
+	}
+	EXPECT_FALSE(FrameFIFO_Get(&fifo, &frame));
+}
+
+/******************* (C) COPYRIGHT 2026 HENIUS *************** END OF FILE ****/
@@ -17,6 +17,11 @@
 #include <string>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
 using namespace std;
 
 // --->User files
@@ -34,6 +39,15 @@ class TEST_CLASS_WITH_PARAM(AsciiHexToByteTest, string) { };
 /*! Test class for testing ByteToAsciiHex function */
 class TEST_CLASS_WITH_PARAM(ByteToAsciiHexTest, uint8_t) { };
 
+/*! Test class for testing HEX codec tables with all values */
+class TEST_CLASS(HexTablesTest) { };
+
+/*! Test class for testing bulk HEX codec (param: length) */
+class TEST_CLASS_WITH_PARAM(BulkHexTest, uint16_t) { };
+
+/*! Test class for HEX codec benchmark */
+class TEST_CLASS(HexCodecBenchmark) { };
+
 /* Function section ----------------------------------------------------------*/
 
 // --->Tests
@@ -73,4 +87,159 @@ UNIT_TEST_WITH_PARAM(ByteToAsciiHexTest, 0x00, 0x22, 0xAA, 0xFF)
 			     expectedAsciiHex.c_str());
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions ByteToAsciiHex and HexToByte - all values, the same
+ * results as sprintf and previous character ranges
+ */
+UNIT_TEST(HexTablesTest)
+{
+	uint8_t result[3];
+	char expected[3];
+
+	for (int value = 0; value < 256; value++)
+	{
+		uint8_t expectedHalfByte = 0;
+
+		ByteToAsciiHex(result, value);
+		snprintf(expected, sizeof(expected), "%02X", value);
+		EXPECT_STREQ(reinterpret_cast<char *>(result), expected);
+
+		if (value >= '0' && value <= '9')
+		{
+			expectedHalfByte = value - '0';
+		}
+		else if (value >= 'a' && value <= 'f')
+		{
+			expectedHalfByte = value - 'a' + 0x0A;
+		}
+		else if (value >= 'A' && value <= 'F')
+		{
+			expectedHalfByte = value - 'A' + 0x0A;
+		}
+		EXPECT_EQ(HexToByte(value), expectedHalfByte);
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Test of functions BytesToAsciiHex and AsciiHexToBytes - the same results as
+ * conversion byte by byte (bulk path and tail)
+ */
+UNIT_TEST_WITH_PARAM(BulkHexTest, 0, 1, 15, 16, 17, 31, 32, 33, 100, 255)
+{
+	const uint16_t length = GetParam();
+	const string digits = "0123456789ABCDEFabcdef";
+	vector<uint8_t> bytes(length + 1), decoded(length + 1);
+	vector<uint8_t> encoded(length * 2 + 1, 0xAA);
+	vector<uint8_t> text(length * 2);
+	mt19937 generator(length);
+	uniform_int_distribution<int> distribution(0, 255);
+
+	for (uint16_t index = 0; index < length; index++)
+	{
+		bytes[index] = distribution(generator);
+	}
+
+	BytesToAsciiHex(encoded.data(), bytes.data(), length);
+	for (uint16_t index = 0; index < length; index++)
+	{
+		uint8_t expected[3];
+
+		ByteToAsciiHex(expected, bytes[index]);
+		ASSERT_EQ(encoded[index * 2], expected[0]);
+		ASSERT_EQ(encoded[index * 2 + 1], expected[1]);
+	}
+	EXPECT_EQ(encoded[length * 2], 0);
+
+	AsciiHexToBytes(decoded.data(), encoded.data(), length);
+	EXPECT_TRUE(equal(bytes.begin(), bytes.begin() + length, decoded.begin()));
+
+	// Mixed case and invalid characters
+	for (uint16_t index = 0; index < length * 2; index++)
+	{
+		text[index] = index % 7 ? digits[distribution(generator) % 22] :
+		                          distribution(generator);
+	}
+	AsciiHexToBytes(decoded.data(), text.data(), length);
+	for (uint16_t index = 0; index < length; index++)
+	{
+		ASSERT_EQ(decoded[index], AsciiHexToByte(&text[index * 2]));
+	}
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+ * Benchmark of HEX codec: sprintf, tables byte by byte and bulk functions
+ */
+UNIT_TEST(HexCodecBenchmark)
+{
+	const int length = 1024;
+	const int runs = 200;
+	vector<uint8_t> bytes(length), decoded(length);
+	vector<uint8_t> encoded(length * 2 + 1);
+	chrono::duration<double, nano> sprintfTime, tableTime, bulkTime;
+	chrono::duration<double, nano> decodeTime, bulkDecodeTime;
+	mt19937 generator(0);
+
+	for (uint8_t &byte : bytes)
+	{
+		byte = generator();
+	}
+
+	auto start = chrono::steady_clock::now();
+	for (int run = 0; run < runs; run++)
+	{
+		for (int index = 0; index < length; index++)
+		{
+			sprintf((char *)&encoded[index * 2], "%02X", bytes[index]);
+		}
+	}
+	sprintfTime = chrono::steady_clock::now() - start;
+
+	start = chrono::steady_clock::now();
+	for (int run = 0; run < runs; run++)
+	{
+		for (int index = 0; index < length; index++)
+		{
+			ByteToAsciiHex(&encoded[index * 2], bytes[index]);
+		}
+	}
+	tableTime = chrono::steady_clock::now() - start;
+
+	start = chrono::steady_clock::now();
+	for (int run = 0; run < runs; run++)
+	{
+		BytesToAsciiHex(encoded.data(), bytes.data(), length);
+	}
+	bulkTime = chrono::steady_clock::now() - start;
+
+	start = chrono::steady_clock::now();
+	for (int run = 0; run < runs; run++)
+	{
+		for (int index = 0; index < length; index++)
+		{
+			decoded[index] = AsciiHexToByte(&encoded[index * 2]);
+		}
+	}
+	decodeTime = chrono::steady_clock::now() - start;
+
+	start = chrono::steady_clock::now();
+	for (int run = 0; run < runs; run++)
+	{
+		AsciiHexToBytes(decoded.data(), encoded.data(), length);
+	}
+	bulkDecodeTime = chrono::steady_clock::now() - start;
+
+	printf("[ BENCH    ] Encode: sprintf %6.2f, table %6.2f, bulk %6.2f "
+	       "ns per byte\n",
+	       sprintfTime.count() / (runs * length),
+	       tableTime.count() / (runs * length),
+	       bulkTime.count() / (runs * length));
+	printf("[ BENCH    ] Decode: table %6.2f, bulk %6.2f ns per byte\n",
+	       decodeTime.count() / (runs * length),
+	       bulkDecodeTime.count() / (runs * length));
+	EXPECT_EQ(decoded, bytes);
+}
+
 /******************* (C) COPYRIGHT 2020 HENIUS *************** END OF FILE ****/